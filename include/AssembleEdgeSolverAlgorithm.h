@@ -44,6 +44,8 @@ public:
 
   virtual void initialize_connectivity();
 
+  bool supports_assembly_phases() const override { return true; }
+
   template <typename LambdaFunction>
   void run_algorithm(stk::mesh::BulkData& bulk, LambdaFunction lambdaFunc)
   {
@@ -68,6 +70,8 @@ public:
     auto coeffApplier = coeff_applier();
 
     const auto nodesPerEntity = nodesPerEntity_;
+    const auto phase = assemblyPhase_;
+    const auto rows = row_ownership();
 
     Kokkos::parallel_for(
       team_exec, KOKKOS_LAMBDA(const DeviceTeamHandleType& team) {
@@ -82,6 +86,10 @@ public:
             auto edge = b[bktIndex];
             const auto edgeIndex = ngpMesh.fast_mesh_index(edge);
             smdata.ngpElemNodes = ngpMesh.get_nodes(entityRank, edgeIndex);
+            if (!in_assembly_phase(
+                  phase, touches_not_owned_row(
+                           rows, smdata.ngpElemNodes, nodesPerEntity)))
+              return;
 
             const auto nodeL = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[0]);
             const auto nodeR = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[1]);
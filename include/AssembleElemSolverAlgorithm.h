@@ -46,6 +46,8 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  bool supports_assembly_phases() const override { return true; }
+
   template <typename LambdaFunction>
   void run_algorithm(stk::mesh::BulkData& bulk_data, LambdaFunction lambdaFunc)
   {
@@ -68,6 +70,11 @@ public:
       lhsSize, rhsSize_, scratchIdsSize, meta_data.spatial_dimension(),
       dataNeededNGP, reqType);
 
+    // Kokkos sizes level-1 scratch for every concurrently resident thread
+    realm_.memory_ledger().record_peak(
+      MemoryLedger::SCRATCH_VIEWS, ledgerName_,
+      static_cast<size_t>(bytes_per_thread) * DeviceSpace().concurrency());
+
     stk::mesh::Selector elemSelector = meta_data.locally_owned_part() &
                                        stk::mesh::selectUnion(partVec_) &
                                        !realm_.get_inactive_selector();
@@ -79,6 +86,8 @@ public:
     const auto entityRank = entityRank_;
     const auto nodesPerEntity = nodesPerEntity_;
     const auto rhsSize = rhsSize_;
+    const auto phase = assemblyPhase_;
+    const auto rows = row_ownership();
 
     auto team_exec = sierra::nalu::get_device_team_policy(
       elem_buckets.size(), bytes_per_team, bytes_per_thread);
@@ -108,12 +117,27 @@ public:
               get_length_of_next_simd_group(bktIndex, bucketLen);
             smdata.numSimdElems = numSimdElems;
 
+            // a SIMD group is assembled in the shared phase if any of its
+            // elements writes a row owned by another rank
+            bool touchesNotOwned = false;
             for (int simdElemIndex = 0; simdElemIndex < numSimdElems;
                  ++simdElemIndex) {
               stk::mesh::Entity element = b[bktIndex * simdLen + simdElemIndex];
               const auto elemIndex = ngpMesh.fast_mesh_index(element);
               smdata.ngpElemNodes[simdElemIndex] =
                 ngpMesh.get_nodes(entityRank, elemIndex);
+              touchesNotOwned =
+                touchesNotOwned ||
+                (phase != AssemblyPhase::ALL &&
+                 touches_not_owned_row(
+                   rows, smdata.ngpElemNodes[simdElemIndex], nodesPerEntity));
+            }
+            if (!in_assembly_phase(phase, touchesNotOwned))
+              return;
+
+            for (int simdElemIndex = 0; simdElemIndex < numSimdElems;
+                 ++simdElemIndex) {
+              stk::mesh::Entity element = b[bktIndex * simdLen + simdElemIndex];
               fill_pre_req_data(
                 dataNeededNGP, ngpMesh, entityRank, element,
                 *smdata.prereqData[simdElemIndex]);
@@ -138,6 +162,9 @@ public:
   double diagRelaxFactor_{1.0};
   unsigned nodesPerEntity_;
   int rhsSize_;
+
+  //! Name used to attribute team scratch in the memory ledger
+  std::string ledgerName_;
 };
 
 } // namespace nalu
@@ -67,6 +67,11 @@ public:
     const int bytes_per_thread = calculate_shared_mem_bytes_per_thread(
       lhsSize, rhsSize, scratchIdsSize, nDim, faceDataNGP, elemDataNGP);
 
+    // Kokkos sizes level-1 scratch for every concurrently resident thread
+    realm_.memory_ledger().record_peak(
+      MemoryLedger::SCRATCH_VIEWS, ledgerName_,
+      static_cast<size_t>(bytes_per_thread) * DeviceSpace().concurrency());
+
     const auto nodesPerFace = nodesPerFace_;
     const auto nodesPerElem = nodesPerElem_;
     stk::mesh::Selector s_locally_owned_union =
@@ -169,6 +174,9 @@ public:
   unsigned nodesPerFace_;
   unsigned nodesPerElem_;
   int rhsSize_;
+
+  //! Name used to attribute team scratch in the memory ledger
+  std::string ledgerName_;
 };
 
 } // namespace nalu
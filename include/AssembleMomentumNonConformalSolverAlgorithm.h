@@ -37,6 +37,9 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // same assembly, from the flat Gauss point data in a device kernel
+  void execute_on_device();
+
   VectorFieldType* velocity_;
   ScalarFieldType* diffFluxCoeff_;
   VectorFieldType* coordinates_;
@@ -47,6 +50,7 @@ public:
   const double eta_;
   const double includeDivU_;
   const double useCurrentNormal_;
+  const bool useDeviceAssembly_;
 
   std::vector<const stk::mesh::FieldBase*> ghostFieldVec_;
 };
@@ -34,12 +34,18 @@ public:
 
   void execute();
 
+  // same gradient contribution, from the flat Gauss point data in a device
+  // kernel
+  void execute_on_device();
+
   ScalarFieldType* scalarQ_;
   VectorFieldType* dqdx_;
 
   ScalarFieldType* dualNodalVolume_;
   GenericFieldType* exposedAreaVec_;
 
+  const bool useDeviceAssembly_;
+
   std::vector<const stk::mesh::FieldBase*> ghostFieldVec_;
 };
 
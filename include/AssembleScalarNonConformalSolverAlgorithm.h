@@ -37,6 +37,9 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // same assembly, from the flat Gauss point data in a device kernel
+  void execute_on_device();
+
   ScalarFieldType* scalarQ_;
   ScalarFieldType* diffFluxCoeff_;
   VectorFieldType* coordinates_;
@@ -46,6 +49,7 @@ public:
   // options that prevail over all algorithms created
   const double eta_;
   const bool useCurrentNormal_;
+  const bool useDeviceAssembly_;
 
   std::vector<const stk::mesh::FieldBase*> ghostFieldVec_;
 };
@@ -33,6 +33,9 @@ public:
 
   void execute();
 
+  // same mdot, from the flat Gauss point data in a device kernel
+  void execute_on_device();
+
   ScalarFieldType* pressure_;
   VectorFieldType* Gjp_;
   VectorFieldType* velocity_;
@@ -44,6 +47,7 @@ public:
 
   const bool meshMotion_;
   const bool useCurrentNormal_;
+  const bool useDeviceAssembly_;
   const double includePstab_;
   double meshMotionFac_;
 
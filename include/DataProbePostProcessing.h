@@ -12,6 +12,7 @@
 
 #include "NaluParsedTypes.h"
 
+#include <array>
 #include <string>
 #include <vector>
 #include <utility>
@@ -43,6 +44,7 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
+class SamplingStencil;
 class Transfer;
 class Transfers;
 
@@ -80,6 +82,11 @@ public:
   std::vector<Coordinates> offsetDir_;
   std::vector<std::vector<double>> offsetSpacings_;
   std::vector<std::string> onlyOutputField_;
+
+  // with sampling stencils the probes have no nodes; the point locations and,
+  // on the owning rank, the sampled values of each field are held here
+  std::vector<std::vector<std::array<double, 3>>> pointCoordinates_;
+  std::vector<std::vector<std::vector<double>>> sampledFields_;
 };
 
 class DataProbeSpecInfo
@@ -97,8 +104,85 @@ public:
   // homegeneous collection of fields over each specification
   std::vector<std::pair<std::string, std::string>> fromToName_;
   std::vector<std::pair<std::string, int>> fieldInfo_;
+
+  // interpolation stencils of all probe points when sampling without nodes
+  std::unique_ptr<SamplingStencil> stencil_;
 };
 
+// Layout and buffered samples of the NetCDF output of one specification
+//
+// The points of all probes of the specification are concatenated in
+// specification order; the file holds time, probe_coordinates and one
+// (num_timesteps, num_points, component) variable per field
+class DataProbeNcInfo
+{
+public:
+  // global offset, size and owning rank of every probe; collective
+  void build_layout(const DataProbeSpecInfo* probeSpec);
+
+  // inverse of pack_probe_fields on the writer rank for numSteps packed
+  // steps; out[ifi] is laid out as (step, point, component); collective
+  void gather(
+    const std::vector<int>& fieldSizes,
+    const int numSteps,
+    const std::vector<double>& local,
+    std::vector<std::vector<double>>& out) const;
+
+  // writer rank only; create a new file holding the probe geometry
+  void create_file(
+    const std::vector<std::pair<std::string, int>>& fieldInfo,
+    const int nDim,
+    const std::vector<double>& coords);
+
+  // writer rank only; reuse an existing file on restart, keeping the steps
+  // up to restartTime. Returns false if there is no file to reuse
+  bool reopen_file(
+    const std::vector<std::pair<std::string, int>>& fieldInfo,
+    const double restartTime);
+
+  // writer rank only; append gathered steps after numTimeSteps_
+  void write_steps(
+    const std::vector<double>& times,
+    const std::vector<int>& fieldSizes,
+    const std::vector<std::vector<double>>& values);
+
+  std::string fileName_;
+  int writerRank_{0};
+  int numPoints_{0};
+
+  // time steps already in the file
+  size_t numTimeSteps_{0};
+
+  // global offset, size, owning rank and name of every probe
+  std::vector<int> probeOffset_;
+  std::vector<int> probeNumPoints_;
+  std::vector<int> probeOwner_;
+  std::vector<std::string> probeNames_;
+
+  // NetCDF ids of time and of each entry of DataProbeSpecInfo::fieldInfo_
+  int timeVarId_{-1};
+  std::vector<int> fieldVarId_;
+
+  // samples of the locally owned probes since the last flush
+  std::vector<double> buffer_;
+};
+
+// append the coordinates of the probes owned by this rank in the order of
+// pack_probe_fields
+void pack_probe_coordinates(
+  const DataProbeSpecInfo* probeSpec,
+  const stk::mesh::FieldBase* coordinates,
+  const int nDim,
+  std::vector<double>& buffer);
+
+// append the values of the probes owned by this rank; fields vary slowest,
+// then probes in specification order, then points and components
+void pack_probe_fields(
+  const DataProbeSpecInfo* probeSpec,
+  const std::vector<const stk::mesh::FieldBase*>& fields,
+  const std::vector<int>& fieldSizes,
+  std::vector<double>& buffer);
+
 class DataProbePostProcessing
 {
 public:
@@ -134,6 +218,10 @@ public:
   // optionally create an exodus database
   void create_exodus();
 
+  // locate the probe points once instead of creating nodes and a transfer
+  void create_sampling_stencils();
+  void sample_with_stencils();
+
   // populate nodal field and output norms (if appropriate)
   void execute();
 
@@ -141,6 +229,15 @@ public:
   void provide_output_txt(const double currentTime);
   void provide_output_exodus(const double currentTime);
 
+  // batched NetCDF output; samples are written every ncBufferSteps_ outputs
+  void prepare_nc_files();
+  void provide_output_nc(const double currentTime);
+  void flush_output_nc();
+
+  // write out anything still buffered; collective, called once at the end of
+  // the run before the realm is torn down
+  void finalize();
+
   // provide the inactive selector
   stk::mesh::Selector& get_inactive_selector();
 
@@ -169,7 +266,7 @@ public:
   stk::mesh::Selector inactiveSelector_;
 
   // hold the transfers
-  Transfers* transfers_;
+  Transfers* transfers_{nullptr};
 
   DataProbeSampleType probeType_;
 
@@ -179,6 +276,11 @@ private:
   double previousTime_;
   bool useExo_{false};
   bool useText_{false};
+  bool useNetCDF_{false};
+  bool useStencils_{false};
+  int ncBufferSteps_{10};
+  std::vector<double> ncTimes_;
+  std::vector<DataProbeNcInfo> ncInfo_;
   bool enablePerfTiming_{false};
   std::string exoName_;
   size_t fileIndex_;
@@ -85,6 +85,9 @@ public:
 
   int opposingFaceIsGhosted_;
 
+  // opposing face found by the warm start; skipped by the coarse search
+  bool warmStartHit_;
+
   // search provides opposing face
   stk::mesh::Entity opposingFace_;
 
@@ -112,7 +115,8 @@ public:
   // iso-parametric coordinates for gauss point on opposing face (-1:1)
   std::vector<double> opposingIsoParCoords_;
 
-  // possible reuse
+  // possible reuse; opposing faces of the last coarse search, which a warm
+  // start hit leaves in place
   std::vector<uint64_t> allOpposingFaceIds_;
   std::vector<uint64_t> allOpposingFaceIdsOld_;
 };
@@ -218,6 +218,13 @@ public:
 
   virtual void dumpMatrixStats();
 
+  /** Estimate of the bytes held by the coefficient applier and HYPRE objects
+   *
+   *  The HYPRE IJ matrix and vectors are not queried directly; their storage
+   *  is estimated from the number of owned nonzeros and rows.
+   */
+  virtual size_t memory_bytes() const;
+
   /** Reset the matrix and rhs data structures for the next iteration/timestep
    *
    */
@@ -11,9 +11,11 @@
 #define InputOutputRealm_h
 
 #include <Realm.h>
+#include <InputPlaneCache.h>
 
 // standard c++
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -79,6 +81,9 @@ public:
 
   // hold the field information
   std::vector<InputOutputInfo*> inputOutputFieldInfo_;
+
+  // resident double-buffered input planes; created on first use
+  std::unique_ptr<InputPlaneCache> inputPlaneCache_;
 };
 
 } // namespace nalu
@@ -0,0 +1,94 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef InputPlaneCache_h
+#define InputPlaneCache_h
+
+#include <stk_mesh/base/Selector.hpp>
+
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace io {
+class StkMeshIoBroker;
+}
+namespace mesh {
+class BulkData;
+class FieldBase;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Resident double-buffered time planes of the input variables of a mesh
+ *
+ *  Keeps the two input database steps bracketing the current time in host
+ *  buffers and interpolates between them into the host fields, where the
+ *  input-output transfer reads them. A step is read from the database only
+ *  when the bracket advances past it, and a step that moves from the upper
+ *  to the lower slot is reused rather than read again, so each input step is
+ *  read once in a forward-running simulation. This saves the repeated reads,
+ *  not the read latency: the step is read synchronously in the update() that
+ *  advances the bracket.
+ */
+class InputPlaneCache
+{
+public:
+  InputPlaneCache(
+    stk::io::StkMeshIoBroker& ioBroker,
+    stk::mesh::BulkData& bulk,
+    const std::vector<stk::mesh::FieldBase*>& fields,
+    const bool interpolate,
+    const double periodicTime,
+    const double startTime);
+
+  //! Fill the fields at the given time; returns the database time used
+  double update(const double time);
+
+  //! Number of database steps read so far
+  int num_reads() const { return numReads_; }
+
+private:
+  double database_time(const double time) const;
+  void build_offsets();
+  void load_step(const int step, const int slot);
+
+  stk::io::StkMeshIoBroker& ioBroker_;
+  stk::mesh::BulkData& bulk_;
+  std::vector<stk::mesh::FieldBase*> fields_;
+  const bool interpolate_;
+  const double periodicTime_;
+  const double startTime_;
+
+  // time of each database step (zero based)
+  std::vector<double> stepTimes_;
+
+  // database step held in each slot, -1 if empty
+  int residentStep_[2] = {-1, -1};
+  int numReads_{0};
+
+  // bucket layout the offsets were built for
+  size_t syncCount_{0};
+
+  // per field: selector and the flat plane offset of each node bucket
+  std::vector<stk::mesh::Selector> selectors_;
+  std::vector<int> fieldSizes_;
+  std::vector<int> missing_;
+  std::vector<std::vector<int>> bucketOffsets_;
+
+  // per field and slot: the plane values in bucket order
+  std::vector<std::vector<double>> planes_[2];
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
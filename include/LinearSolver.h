@@ -12,6 +12,7 @@
 
 #include <LinearSolverTypes.h>
 #include <LinearSolverConfig.h>
+#include <MixedPrecisionOperator.h>
 
 #include <Kokkos_DefaultNode.hpp>
 #include <Tpetra_Details_DefaultTypes.hpp>
@@ -22,6 +23,10 @@
 
 #include <Ifpack2_Factory.hpp>
 
+#include <BelosStatusTest.hpp>
+#include <BelosStatusTestGenResNorm.hpp>
+#include <BelosTpetraAdapter.hpp>
+
 // Header files defining default types for template parameters.
 // These headers must be included after other MueLu/Xpetra headers.
 using Scalar = sierra::nalu::LinSys::Scalar;
@@ -38,6 +43,7 @@ using STS = Teuchos::ScalarTraits<Scalar>;
 
 #include <MueLu_UseShortNames.hpp> // => typedef MueLu::FooClass<Scalar, LocalOrdinal, ...> Foo
 #include <limits>
+#include <vector>
 
 namespace sierra {
 namespace nalu {
@@ -202,6 +208,43 @@ public:
   LinearSolverConfig* getConfig() { return config_; }
 };
 
+/** Record the iteration at which each right-hand side of a multi-vector
+ *  solve first satisfies the convergence tolerance
+ *
+ *  Attached to the Belos solver as an OR-combined user test that never
+ *  reports convergence, so the iteration is still controlled by the solver's
+ *  own test. Used by the segregated momentum solve, where the three velocity
+ *  components share one matrix and are solved as a single block.
+ */
+class ComponentIterationTest
+  : public Belos::
+      StatusTest<LinSys::Scalar, LinSys::MultiVector, LinSys::Operator>
+{
+public:
+  using IterationType =
+    Belos::Iteration<LinSys::Scalar, LinSys::MultiVector, LinSys::Operator>;
+  using ResNormTest = Belos::
+    StatusTestGenResNorm<LinSys::Scalar, LinSys::MultiVector, LinSys::Operator>;
+
+  explicit ComponentIterationTest(double tolerance);
+
+  void set_tolerance(double tolerance);
+
+  Belos::StatusType checkStatus(IterationType* iSolver) override;
+  Belos::StatusType getStatus() const override { return Belos::Failed; }
+  void reset() override;
+  void print(std::ostream& os, int indent = 0) const override;
+
+  //! Iterations to convergence of component k, or totalIters if it did not
+  //! converge before the solver stopped
+  int iterations(size_t k, int totalIters) const;
+
+private:
+  Teuchos::RCP<ResNormTest> resNormTest_;
+  std::vector<int> iterations_;
+  double tolerance_;
+};
+
 class TpetraLinearSolver : public LinearSolver
 {
 public:
@@ -231,6 +274,14 @@ public:
   //! Initialize the MueLU preconditioner before solve
   void setMueLu();
 
+  /** Build (or refresh) the single-precision preconditioner before solve
+   *
+   *  Only active when `mixed_precision` is set in the solver options. The
+   *  float copy of the matrix is created on the first solve after the matrix
+   *  is fill-complete and only has its values refreshed afterwards.
+   */
+  void setMixedPrecisionPreconditioner();
+
   /** Compute the norm of the non-linear solution vector
    *
    *  @param[in] whichNorm [0, 1, 2] norm to be computed
@@ -259,7 +310,22 @@ public:
     return (config_->useSegregatedSolver() ? PT_TPETRA_SEGREGATED : PT_TPETRA);
   }
 
+  //! Iterations to convergence of each right-hand side in the last solve
+  const std::vector<int>& component_iterations() const
+  {
+    return componentIterations_;
+  }
+
+  //! Final residual norm of each right-hand side in the last solve
+  const std::vector<double>& component_residual_norms() const
+  {
+    return componentResidualNorms_;
+  }
+
 private:
+  //! Create the Belos solver manager and attach it to the linear problem
+  void createSolver();
+
   //! The solver parameters
   const Teuchos::RCP<Teuchos::ParameterList> params_;
 
@@ -272,8 +338,30 @@ private:
   Teuchos::RCP<LinSys::Preconditioner> preconditioner_;
   Teuchos::RCP<MueLu::TpetraOperator<SC, LO, GO, NO>> mueluPreconditioner_;
   Teuchos::RCP<LinSys::MultiVector> coords_;
+  Teuchos::RCP<ComponentIterationTest> componentTest_;
+  std::vector<int> componentIterations_;
+  std::vector<double> componentResidualNorms_;
+
+#ifdef NALU_HAS_MIXED_PRECISION
+  using FloatPreconditioner = Ifpack2::Preconditioner<
+    LinSysFloat::Scalar,
+    LinSysFloat::LocalOrdinal,
+    LinSysFloat::GlobalOrdinal,
+    LinSysFloat::Node>;
+  using FloatMueLuOperator = MueLu::TpetraOperator<
+    LinSysFloat::Scalar,
+    LinSysFloat::LocalOrdinal,
+    LinSysFloat::GlobalOrdinal,
+    LinSysFloat::Node>;
+
+  Teuchos::RCP<LinSysFloat::Matrix> floatMatrix_;
+  Teuchos::RCP<FloatPreconditioner> floatPreconditioner_;
+  Teuchos::RCP<FloatMueLuOperator> floatMueluPreconditioner_;
+  Teuchos::RCP<MixedPrecisionOperator> mixedPrecisionOperator_;
+#endif
 
   std::string preconditionerType_;
+  bool useMixedPrecision_{false};
 };
 
 } // namespace nalu
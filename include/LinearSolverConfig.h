@@ -58,6 +58,11 @@ public:
 
   inline bool useSegregatedSolver() const { return useSegregatedSolver_; }
 
+  /** User flag indicating whether the preconditioner is built and applied in
+   *  single precision while the outer Krylov solver remains in double
+   */
+  inline bool useMixedPrecision() const { return useMixedPrecision_; }
+
   /** User flag indicating whether equation systems must attempt to reuse linear
    *  system data structures even for cases with mesh motion.
    *
@@ -97,6 +102,7 @@ protected:
   bool useSegregatedSolver_{false};
   bool writeMatrixFiles_{false};
   bool reuseLinSysIfPossible_{false};
+  bool useMixedPrecision_{false};
 };
 
 class TpetraLinearSolverConfig : public LinearSolverConfig
@@ -85,6 +85,21 @@ struct CoeffApplierDestructor
   }
 };
 
+//! Device lookup of the nodes whose linear system rows this rank owns
+struct RowOwnership
+{
+  LinSys::ConstEntityToLIDView rowLIDs;
+  LinSys::LocalOrdinal maxOwnedRowId{0};
+
+  //! Without a row map every node is treated as owning its row
+  KOKKOS_INLINE_FUNCTION
+  bool owns_row(const stk::mesh::Entity node) const
+  {
+    return (rowLIDs.extent(0) == 0) ||
+           (rowLIDs(node.local_offset()) < maxOwnedRowId);
+  }
+};
+
 class LinearSystem
 {
 public:
@@ -205,6 +220,14 @@ public:
   virtual int solve(stk::mesh::FieldBase* linearSolutionField) = 0;
   virtual void loadComplete() = 0;
 
+  // Start communicating the shared-not-owned rows once every contribution to
+  // them is assembled; loadComplete() finishes the exchange
+  virtual void beginSharedRowExchange() {}
+
+  // Rows that beginSharedRowExchange() sends to other ranks are the ones this
+  // lookup reports as not owned; periodic slave nodes follow their master
+  virtual RowOwnership row_ownership() const { return RowOwnership(); }
+
   virtual void writeToFile(const char* filename, bool useOwned = true) = 0;
   virtual void
   writeSolutionToFile(const char* filename, bool useOwned = true) = 0;
@@ -226,6 +249,13 @@ public:
 
   EquationSystem* equationSystem() { return eqSys_; }
 
+  /** Estimate of the bytes held by the matrix, vectors and coefficient applier
+   *
+   *  Used by the memory ledger to attribute memory to each linear system;
+   *  implementations that cannot query their storage report zero.
+   */
+  virtual size_t memory_bytes() const { return 0; }
+
 protected:
   virtual void beginLinearSystemConstruction() = 0;
   virtual void checkError(const int err_code, const char* msg) = 0;
@@ -0,0 +1,109 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MixedPrecisionOperator_h
+#define MixedPrecisionOperator_h
+
+#include <LinearSolverTypes.h>
+#include <TpetraCore_config.h>
+
+#include <Teuchos_RCP.hpp>
+
+#ifdef HAVE_TPETRA_INST_FLOAT
+#define NALU_HAS_MIXED_PRECISION 1
+#endif
+
+namespace sierra {
+namespace nalu {
+
+#ifdef NALU_HAS_MIXED_PRECISION
+
+/** Single-precision counterparts of the linear system types
+ */
+struct LinSysFloat
+{
+  using Scalar = float;
+  using LocalOrdinal = LinSys::LocalOrdinal;
+  using GlobalOrdinal = LinSys::GlobalOrdinal;
+  using Node = LinSys::Node;
+  using MultiVector =
+    Tpetra::MultiVector<Scalar, LocalOrdinal, GlobalOrdinal, Node>;
+  using Matrix = Tpetra::CrsMatrix<Scalar, LocalOrdinal, GlobalOrdinal, Node>;
+  using Operator = Tpetra::Operator<Scalar, LocalOrdinal, GlobalOrdinal, Node>;
+};
+
+/** Apply a single-precision operator (typically a preconditioner) to
+ *  double-precision vectors
+ *
+ *  The preconditioner is memory-bandwidth bound, so building it on a float copy
+ *  of the matrix halves the bytes streamed per application. The outer Krylov
+ *  iteration remains in double precision and computes its residuals against
+ *  the double-precision matrix, which acts as the iterative refinement of the
+ *  low-precision correction.
+ */
+class MixedPrecisionOperator : public LinSys::Operator
+{
+public:
+  explicit MixedPrecisionOperator(
+    const Teuchos::RCP<LinSysFloat::Operator>& op);
+
+  virtual ~MixedPrecisionOperator() = default;
+
+  Teuchos::RCP<const LinSys::Map> getDomainMap() const override
+  {
+    return op_->getDomainMap();
+  }
+
+  Teuchos::RCP<const LinSys::Map> getRangeMap() const override
+  {
+    return op_->getRangeMap();
+  }
+
+  void apply(
+    const LinSys::MultiVector& X,
+    LinSys::MultiVector& Y,
+    Teuchos::ETransp mode = Teuchos::NO_TRANS,
+    LinSys::Scalar alpha = Teuchos::ScalarTraits<LinSys::Scalar>::one(),
+    LinSys::Scalar beta =
+      Teuchos::ScalarTraits<LinSys::Scalar>::zero()) const override;
+
+  const Teuchos::RCP<LinSysFloat::Operator>& float_operator() const
+  {
+    return op_;
+  }
+
+private:
+  void ensure_work_vectors(size_t numVecs) const;
+
+  Teuchos::RCP<LinSysFloat::Operator> op_;
+
+  mutable Teuchos::RCP<LinSysFloat::MultiVector> xFloat_;
+  mutable Teuchos::RCP<LinSysFloat::MultiVector> yFloat_;
+  mutable Teuchos::RCP<LinSys::MultiVector> yDouble_;
+};
+
+/** Create a single-precision copy of the matrix sharing its row/column maps
+ */
+Teuchos::RCP<LinSysFloat::Matrix>
+create_float_matrix(const Teuchos::RCP<LinSys::Matrix>& matrix);
+
+/** Refresh the values of a float copy created by create_float_matrix
+ *
+ *  The graph is unchanged between nonlinear iterations, so only the values
+ *  are converted instead of rebuilding the copy.
+ */
+void copy_values_to_float_matrix(
+  const LinSys::Matrix& matrix, LinSysFloat::Matrix& floatMatrix);
+
+#endif
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MixedPrecisionOperator_h */
@@ -256,13 +256,15 @@ struct NonConformalUserData : public UserData
   bool clipIsoParametricCoords_;
   double searchTolerance_;
   bool dynamicSearchTolAlg_;
+  bool warmStartSearch_;
   NonConformalUserData()
     : UserData(),
       searchMethodName_("na"),
       expandBoxPercentage_(0.0),
       clipIsoParametricCoords_(false),
       searchTolerance_(1.0e-16),
-      dynamicSearchTolAlg_(false)
+      dynamicSearchTolAlg_(false),
+      warmStartSearch_(false)
   {
   }
 };
@@ -0,0 +1,115 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NonConformalGaussPointData_h
+#define NonConformalGaussPointData_h
+
+#include <KokkosInterface.h>
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+class DgInfo;
+
+/** Structure-of-arrays copy of the DgInfo of a non-conformal interface
+ *
+ *  Flattens the Gauss points of a NonConformalInfo into device views so
+ *  that the interface can be assembled in device kernels. Everything that
+ *  needs a master element (shape functions at the current and opposing
+ *  isoparametric coordinates, the element gradient operators and the
+ *  opposing normal) is evaluated once on the host when the data is built,
+ *  since the master element routines involved are host only. The node
+ *  stencils are stored in CSR form, indexed by Gauss point.
+ *
+ *  The data depends on the coordinates and on the bucket layout, so it is
+ *  rebuilt after every search and whenever the mesh is modified.
+ */
+class NonConformalGaussPointData
+{
+public:
+  template <typename T>
+  using DeviceView = Kokkos::View<T, MemSpace>;
+
+  NonConformalGaussPointData(
+    const stk::mesh::BulkData& bulk,
+    const stk::mesh::FieldBase& coordinates,
+    const std::vector<std::vector<DgInfo*>>& dgInfoVec);
+
+  int num_points() const { return numPoints_; }
+
+  //! bulk synchronized count the data was built for
+  size_t sync_count() const { return syncCount_; }
+
+  //! largest connected node stencil; sizes the assembly scratch
+  int max_connected_nodes() const { return maxConnectedNodes_; }
+
+  int numPoints_{0};
+  size_t syncCount_{0};
+  int maxConnectedNodes_{0};
+
+  // current face and the Gauss point on it
+  DeviceView<stk::mesh::FastMeshIndex*> currentFace_;
+  DeviceView<int*> currentGaussPointId_;
+
+  // node nearest to the Gauss point; on the current face for the nodal
+  // gradient, and as an ordinal of the current element for the row
+  // assembled into the linear system
+  DeviceView<stk::mesh::FastMeshIndex*> currentNearestNode_;
+  DeviceView<int*> currentNearestElemNode_;
+
+  // face nodes and shape functions at the Gauss point
+  DeviceView<int*> currentFaceOffsets_;
+  DeviceView<stk::mesh::FastMeshIndex*> currentFaceNodes_;
+  DeviceView<double*> currentFaceShapeFcn_;
+  DeviceView<int*> opposingFaceOffsets_;
+  DeviceView<stk::mesh::FastMeshIndex*> opposingFaceNodes_;
+  DeviceView<double*> opposingFaceShapeFcn_;
+
+  // element ordinals of the face nodes, in the face node order
+  DeviceView<int*> currentFaceElemOrdinals_;
+  DeviceView<int*> opposingFaceElemOrdinals_;
+
+  // element nodes and gradient operators (nDim per node) at the Gauss point
+  DeviceView<int*> currentElemOffsets_;
+  DeviceView<stk::mesh::FastMeshIndex*> currentElemNodes_;
+  DeviceView<double*> currentElemDndx_;
+  DeviceView<int*> opposingElemOffsets_;
+  DeviceView<stk::mesh::FastMeshIndex*> opposingElemNodes_;
+  DeviceView<double*> opposingElemDndx_;
+
+  // current element nodes followed by the opposing element nodes; the
+  // stencil summed into the linear system
+  DeviceView<int*> connectedOffsets_;
+  DeviceView<stk::mesh::Entity*> connectedNodes_;
+
+  // sum of the gradient operators over the face nodes; dotted with the
+  // normal this gives the inverse length scale
+  DeviceView<double**> currentFaceDndxSum_;
+  DeviceView<double**> opposingFaceDndxSum_;
+
+  // normal of the opposing face at the Gauss point
+  DeviceView<double**> opposingNormal_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -26,6 +26,7 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 
 namespace stk {
 namespace mesh {
@@ -38,6 +39,7 @@ namespace nalu {
 
 class Realm;
 class DgInfo;
+class NonConformalGaussPointData;
 
 typedef stk::search::IdentProc<uint64_t, int> theKey;
 typedef stk::search::Point<double> Point;
@@ -73,6 +75,7 @@ public:
     const bool clipIsoParametricCoords,
     const double searchTolerance,
     const bool dynamicSearchTolAlg,
+    const bool warmStartSearch,
     const std::string debugName);
 
   ~NonConformalInfo();
@@ -89,11 +92,15 @@ public:
   void reset_dgInfo();
   void construct_bounding_points();
   void construct_bounding_boxes();
+  void warm_start_search();
   void determine_elems_to_ghost();
   void complete_search();
   void provide_diagnosis();
   size_t error_check();
 
+  /* flat device copy of dgInfoVec_; built on first use after each search */
+  const NonConformalGaussPointData& gauss_point_data();
+
   Realm& realm_;
   const std::string name_;
 
@@ -116,6 +123,10 @@ public:
    * as point radius from isInElem */
   const bool dynamicSearchTolAlg_;
 
+  /* try the previous opposing face and its neighbors before the coarse
+   * search */
+  const bool warmStartSearch_;
+
   /* does the realm have mesh motion */
   const bool meshMotion_;
 
@@ -132,6 +143,8 @@ public:
   /* save off product of search */
   std::vector<std::pair<theKey, theKey>> searchKeyPair_;
 
+  std::unique_ptr<NonConformalGaussPointData> gaussPointData_;
+
 private:
   void delete_range_points_found(
     std::vector<boundingSphere>& boundingSphereVec,
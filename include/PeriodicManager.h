@@ -58,6 +58,10 @@ public:
 
   void build_constraints();
 
+  // redo the search and ghosting after the mesh has been redistributed; the
+  // selector pairs and translations from build_constraints() are kept
+  void rebuild_constraints();
+
   // holder for master += slave; slave = master
   void apply_constraints(
     stk::mesh::FieldBase*,
@@ -75,7 +79,8 @@ public:
     const bool& doCommunication = true) const;
 
   // find the max
-  void apply_max_field(stk::mesh::FieldBase*, const unsigned& sizeOfField);
+  void ngp_apply_max_field(
+    stk::mesh::FieldBase*, const unsigned& sizeOfField) const;
 
   void manage_ghosting_object();
 
@@ -162,7 +167,15 @@ public:
     const bool& bypassFieldCheck,
     const bool& doCommunication) const;
 
+  /* owned -> ghosted update of the periodic ghosting on the device */
+  void ngp_periodic_exchange(
+    NGPDoubleFieldType& ngpField, const unsigned& stride) const;
+
 private:
+  typedef Kokkos::View<stk::mesh::Entity*, Kokkos::LayoutRight, MemSpace>
+    EntityView;
+  typedef Kokkos::View<double*, Kokkos::LayoutRight, MemSpace> BufferView;
+
   // vector of master:slave selector pairs
   std::vector<SelectorPair> periodicSelectorPairs_;
 
@@ -186,6 +199,21 @@ private:
   // culmination of all searches
   SearchKeyVector searchKeyVector_;
 
+  // exchange plan for the periodic ghosting; the nodes sent to and received
+  // from ghostCommProcs_[p] are in [offsets[p], offsets[p+1]), sorted by key
+  EntityView ghostSendNodes_;
+  EntityView ghostRecvNodes_;
+  std::vector<int> ghostSendOffsets_;
+  std::vector<int> ghostRecvOffsets_;
+
+  // grown on demand by ngp_periodic_exchange
+  mutable BufferView sendBuffer_;
+  mutable BufferView recvBuffer_;
+  mutable BufferView::HostMirror hostSendBuffer_;
+  mutable BufferView::HostMirror hostRecvBuffer_;
+
+  void build_ghost_exchange_plan();
+
   void add_slave_to_master(
     stk::mesh::FieldBase* theField,
     const unsigned& sizeOfField,
@@ -23,6 +23,9 @@
 #endif
 
 #include <ngp_utils/NgpFieldManager.h>
+#include "utils/DeferredReductions.h"
+#include "utils/FieldExchangePlan.h"
+#include "utils/MemoryLedger.h"
 #include "ngp_utils/NgpMeshInfo.h"
 
 #include "stk_mesh/base/NgpMesh.hpp"
@@ -121,6 +124,18 @@ public:
   bool get_activate_memory_diagnostic();
   void provide_memory_summary();
   std::string convert_bytes(double bytes);
+  MemoryLedger& memory_ledger() { return memoryLedger_; }
+
+  DeferredReductions& deferred_reductions() { return deferredReductions_; }
+
+  //! Complete all reductions deferred since the last sync point
+  void flush_deferred_reductions();
+
+  //! Cached shared-node exchange for a field set, rebuilt after mesh changes
+  FieldExchangePlan& field_exchange_plan(
+    FieldExchangePlan::Operation op,
+    const std::vector<const stk::mesh::FieldBase*>& fields,
+    const stk::mesh::Selector& selector);
 
   void create_mesh();
 
@@ -147,6 +162,19 @@ public:
 
   void balance_nodes();
 
+  // in-run rebalancing on the measured per-rank cost; returns true when the
+  // mesh was redistributed
+  bool dynamic_rebalance();
+  double dynamic_rebalance_cost();
+  void check_dynamic_rebalance_support();
+  void reopen_output_after_rebalance();
+
+  // per-rank snapshot of the decomposed and balanced mesh
+  bool mesh_cache_supported();
+  std::string mesh_cache_key() const;
+  bool mesh_cache_is_valid();
+  void write_mesh_cache();
+
   void create_output_mesh();
   void create_restart_mesh();
   void input_variables_from_mesh();
@@ -177,6 +205,9 @@ public:
   void initialize_non_conformal();
   void initialize_post_processing_algorithms();
 
+  //! Flush buffered post-processing output at the end of the run
+  void finalize_post_processing();
+
   void compute_geometry();
   void compute_vrtm(const std::string& = "velocity");
   void compute_l2_scaling();
@@ -233,9 +264,6 @@ public:
     const unsigned& sizeOfField,
     const bool& doCommunication = true) const;
 
-  void periodic_max_field_update(
-    stk::mesh::FieldBase* theField, const unsigned& sizeOfField) const;
-
   const stk::mesh::PartVector& get_slave_part_vector();
 
   void overset_field_update(
@@ -310,6 +338,7 @@ public:
   bool get_nc_alg_upwind_advection();
   bool get_nc_alg_include_pstab();
   bool get_nc_alg_current_normal();
+  bool get_nc_alg_device_assembly();
 
   PropertyEvaluator* get_material_prop_eval(const PropertyIdentifier thePropID);
 
@@ -488,12 +517,50 @@ public:
 
   std::string rebalanceMethod_;
 
+  // in-run rebalancing; the cost of each rank since the last check is spread
+  // over its owned elements as stk_balance vertex weights
+  struct DynamicRebalanceOptions
+  {
+    int frequency{0};
+    double threshold{1.25};
+    std::string method{"rcb"};
+  };
+  DynamicRebalanceOptions dynamicRebalanceOptions_;
+  double dynamicRebalanceCostMark_{0.0};
+  int numDynamicRebalances_{0};
+  bool meshRebalanced_{false};
+  double timerDynamicRebalance_{0.0};
+
+  // output and restart names before the first in-run rebalance
+  std::string outputBaseName_;
+  std::string restartBaseName_;
+
+  // preprocessed mesh cache; read instead of the input mesh when its key
+  // matches, otherwise written once the mesh is balanced
+  std::string meshCacheName_;
+  bool useMeshCache_{false};
+
   // allow aura to be optional
   bool activateAura_;
 
+  // assemble shared-node contributions first and overlap their communication
+  // with the rank-interior assembly
+  bool overlapAssemblyComm_{false};
+
   // allow detailed output (memory) to be provided
   bool activateMemoryDiagnostic_;
 
+  // per-rank attribution of bytes to fields, linear systems, scratch, etc.
+  MemoryLedger memoryLedger_;
+
+  // small global reductions coalesced until the next sync point
+  DeferredReductions deferredReductions_;
+
+  // persistent shared-node exchanges keyed by operation, fields and selector
+  std::map<std::string, std::unique_ptr<FieldExchangePlan>>
+    fieldExchangePlans_;
+  int nextExchangeTag_{22000};
+
   // sometimes restarts can be missing states or dofs
   bool supportInconsistentRestart_;
 
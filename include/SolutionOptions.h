@@ -131,11 +131,13 @@ public:
   bool ncAlgCoincidentNodesErrorCheck_;
   bool ncAlgCurrentNormal_;
   bool ncAlgPngPenalty_;
+  bool ncAlgDeviceAssembly_;
   bool cvfemShiftMdot_;
   bool cvfemReducedSensPoisson_;
   double inputVariablesRestorationTime_;
   bool inputVariablesInterpolateInTime_;
   double inputVariablesPeriodicTime_;
+  bool inputVariablesResidentPlanes_;
   bool consistentMMPngDefault_;
   bool useConsolidatedSolverAlg_;
   bool useConsolidatedBcSolverAlg_;
@@ -27,6 +27,37 @@ class CoeffApplier;
 class EquationSystem;
 class Realm;
 
+//! Subset of the locally owned entities assembled by one pass of a solver
+//! algorithm; see SolverAlgorithmDriver::execute_overlapped
+enum class AssemblyPhase {
+  ALL = 0,  //!< every entity
+  SHARED,   //!< entities with a node whose row another rank owns
+  INTERIOR, //!< entities that only write rows owned by this rank
+};
+
+//! True if any of the first numNodes nodes has a row owned by another rank
+KOKKOS_INLINE_FUNCTION
+bool
+touches_not_owned_row(
+  const RowOwnership& rows,
+  const stk::mesh::NgpMesh::ConnectedNodes& nodes,
+  const unsigned numNodes)
+{
+  for (unsigned n = 0; n < numNodes; ++n) {
+    if (!rows.owns_row(nodes[n]))
+      return true;
+  }
+  return false;
+}
+
+KOKKOS_INLINE_FUNCTION
+bool
+in_assembly_phase(const AssemblyPhase phase, const bool touchesNotOwned)
+{
+  return (phase == AssemblyPhase::ALL) ||
+         (touchesNotOwned == (phase == AssemblyPhase::SHARED));
+}
+
 struct NGPApplyCoeff
 {
   NGPApplyCoeff(EquationSystem*);
@@ -85,9 +116,17 @@ public:
   virtual void execute() = 0;
   virtual void initialize_connectivity() = 0;
 
+  //! Algorithms that can restrict execute() to an AssemblyPhase; all others
+  //! are run in full before the shared rows are communicated
+  virtual bool supports_assembly_phases() const { return false; }
+  void set_assembly_phase(const AssemblyPhase phase) { assemblyPhase_ = phase; }
+
 protected:
   NGPApplyCoeff coeff_applier() { return NGPApplyCoeff(eqSystem_); }
 
+  //! Row ownership of the linear system the algorithm assembles into
+  RowOwnership row_ownership() const;
+
   // Need to find out whether this ever gets called inside a modification cycle.
   void apply_coeff(
     const std::vector<stk::mesh::Entity>& sym_meshobj,
@@ -98,6 +137,7 @@ protected:
     const char* trace_tag = 0);
 
   EquationSystem* eqSystem_;
+  AssemblyPhase assemblyPhase_{AssemblyPhase::ALL};
 };
 
 } // namespace nalu
@@ -18,6 +18,7 @@
 namespace sierra {
 namespace nalu {
 
+class LinearSystem;
 class Realm;
 class SolverAlgorithm;
 
@@ -32,6 +33,10 @@ public:
   virtual void execute();
   virtual void post_work();
 
+  // assemble entities that write rows owned by other ranks first, start the
+  // shared-row exchange of linsys, then assemble the remaining entities
+  void execute_overlapped(LinearSystem& linsys);
+
   // different types of algorithms... interior/flux; constraints and dirichlet
   std::map<std::string, SolverAlgorithm*> solverAlgorithmMap_;
   std::map<AlgorithmType, SolverAlgorithm*> solverAlgMap_;
@@ -0,0 +1,73 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef SurfaceForceAndMomentUtils_h
+#define SurfaceForceAndMomentUtils_h
+
+#include <KokkosInterface.h>
+#include <ngp_utils/NgpReducers.h>
+
+#include <stk_topology/topology.hpp>
+
+#include <string>
+
+namespace sierra {
+namespace nalu {
+
+//! Pressure force, viscous force and moment sums; min/max hold the y+ range
+using SurfaceForceReducer = nalu_ngp::ArraySumMinMax<double, 9>;
+using SurfaceForceValue = SurfaceForceReducer::value_type;
+
+/** Device copies of the face/element master element data used by the surface
+ *  force post processing for one (face, element) topology pair
+ */
+struct SurfaceForceTopoData
+{
+  int numScsBip{0};
+  int nodesPerFace{0};
+
+  //! (numScsBip, nodesPerFace) face shape functions
+  Kokkos::View<double**, MemSpace> shapeFcn;
+
+  //! face node nearest to each integration point
+  Kokkos::View<int*, MemSpace> ipNodeMap;
+
+  //! (face ordinal, ip) element node opposing each integration point
+  Kokkos::View<int**, MemSpace> opposingNodes;
+};
+
+SurfaceForceTopoData make_surface_force_topo_data(
+  const stk::topology& faceTopo,
+  const stk::topology& elemTopo,
+  const bool useShifted);
+
+KOKKOS_INLINE_FUNCTION
+void
+surface_force_cross_product(
+  const double* force, double* cross, const double* rad)
+{
+  cross[0] = rad[1] * force[2] - rad[2] * force[1];
+  cross[1] = -(rad[0] * force[2] - rad[2] * force[0]);
+  cross[2] = rad[0] * force[1] - rad[1] * force[0];
+}
+
+//! Write the column header of the force/moment file on rank 0
+void write_surface_force_banner(const std::string& fileName, const int w);
+
+//! Reduce the local sums and y+ range and append them on rank 0
+void write_surface_force_output(
+  const std::string& fileName,
+  const int w,
+  const double currentTime,
+  const SurfaceForceValue& localValue);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
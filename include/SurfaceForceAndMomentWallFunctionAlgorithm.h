@@ -12,6 +12,7 @@
 
 #include <Algorithm.h>
 #include <FieldTypeDef.h>
+#include <SurfaceForceAndMomentUtils.h>
 
 // stk
 #include <stk_mesh/base/Part.hpp>
@@ -37,8 +38,6 @@ public:
 
   void pre_work();
 
-  void cross_product(double* force, double* cross, double* rad);
-
   const std::string& outputFileName_;
   const int& frequency_;
   const std::vector<double>& parameters_;
@@ -47,22 +46,28 @@ public:
   const double elog_;
   const double kappa_;
 
-  VectorFieldType* coordinates_;
-  VectorFieldType* velocity_;
-  ScalarFieldType* pressure_;
-  VectorFieldType* pressureForce_;
-  VectorFieldType* viscousForce_;
-  ScalarFieldType* tauWall_;
-  ScalarFieldType* yplus_;
-  VectorFieldType* bcVelocity_;
-  ScalarFieldType* density_;
-  ScalarFieldType* viscosity_;
-  GenericFieldType* wallFrictionVelocityBip_;
-  GenericFieldType* wallNormalDistanceBip_;
-  GenericFieldType* exposedAreaVec_;
-  ScalarFieldType* assembledArea_;
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned velocity_{stk::mesh::InvalidOrdinal};
+  unsigned pressure_{stk::mesh::InvalidOrdinal};
+  unsigned pressureForce_{stk::mesh::InvalidOrdinal};
+  unsigned viscousForce_{stk::mesh::InvalidOrdinal};
+  unsigned tauWall_{stk::mesh::InvalidOrdinal};
+  unsigned yplus_{stk::mesh::InvalidOrdinal};
+  unsigned bcVelocity_{stk::mesh::InvalidOrdinal};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned viscosity_{stk::mesh::InvalidOrdinal};
+  unsigned wallFrictionVelocityBip_{stk::mesh::InvalidOrdinal};
+  unsigned wallNormalDistanceBip_{stk::mesh::InvalidOrdinal};
+  unsigned exposedAreaVec_{stk::mesh::InvalidOrdinal};
+  unsigned assembledArea_{stk::mesh::InvalidOrdinal};
 
   const int w_;
+
+private:
+  //! Master element data for each part in partVec_, built on first use
+  const std::vector<SurfaceForceTopoData>& topo_data();
+
+  std::vector<SurfaceForceTopoData> topoData_;
 };
 
 } // namespace nalu
@@ -140,9 +140,15 @@ public:
   // Solve
   int solve(stk::mesh::FieldBase* linearSolutionField) override;
   void loadComplete() override;
+  void beginSharedRowExchange() override;
+  RowOwnership row_ownership() const override
+  {
+    return RowOwnership{entityToLID_, maxOwnedRowId_};
+  }
   void writeToFile(const char* filename, bool useOwned = true) override;
   void printInfo(bool useOwned = true);
   void writeSolutionToFile(const char* filename, bool useOwned = true) override;
+  size_t memory_bytes() const override;
   size_t lookup_myLID(
     MyLIDMapType& myLIDs,
     stk::mesh::EntityId entityId,
@@ -333,6 +339,7 @@ public:
   Teuchos::RCP<LinSys::MultiVector> sln_;
   Teuchos::RCP<LinSys::MultiVector> globalSln_;
   Teuchos::RCP<LinSys::Export> exporter_;
+  bool sharedRowExchangeStarted_{false};
 
   MyLIDMapType myLIDs_;
   LinSys::EntityToLIDView entityToColLID_;
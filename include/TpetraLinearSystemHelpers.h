@@ -127,6 +127,14 @@ void fill_in_extra_dof_rows_per_node(LocalGraphArrays& csg, int numDof);
 void remove_invalid_indices(
   LocalGraphArrays& csg, LinSys::HostRowLengths& rowLengths);
 
+/** Bytes held by the local CSR arrays of a matrix (values, columns, offsets)
+ */
+size_t matrix_memory_bytes(const Teuchos::RCP<LinSys::Matrix>& matrix);
+
+/** Bytes held by the local data of a multivector
+ */
+size_t vector_memory_bytes(const Teuchos::RCP<LinSys::MultiVector>& vec);
+
 template <typename ViewType>
 void
 sync_dual_view_host_to_device(ViewType viewToSync)
@@ -139,6 +139,7 @@ public:
   void writeToFile(const char* filename, bool useOwned = true);
   void printInfo(bool useOwned = true);
   void writeSolutionToFile(const char* filename, bool useOwned = true);
+  size_t memory_bytes() const override;
   size_t lookup_myLID(
     MyLIDMapType& myLIDs,
     stk::mesh::EntityId entityId,
@@ -327,6 +328,10 @@ private:
                                         // num_sharedNotOwned_nodes) * numDof_
 
   std::vector<int> sortPermutation_;
+
+  // Per-component first nonlinear residual of the block (multi-RHS) solve
+  std::vector<double> firstNLR_;
+  std::vector<std::string> vecNames_{"X", "Y", "Z"};
 };
 
 int getDofStatus_impl(stk::mesh::Entity node, const Realm& realm);
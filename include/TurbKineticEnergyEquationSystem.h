@@ -81,6 +81,15 @@ public:
   void manage_projected_nodal_gradient(EquationSystems& eqSystems);
   void compute_projected_nodal_gradient();
 
+  /** Split form of compute_projected_nodal_gradient()
+   *
+   *  With the lumped projection the shared-node exchange of dkdx is left in
+   *  flight by start_projected_nodal_gradient() and completed by
+   *  finish_projected_nodal_gradient(); dkdx must not be read in between.
+   */
+  void start_projected_nodal_gradient();
+  void finish_projected_nodal_gradient();
+
   void post_external_data_transfer_work();
   static bool check_for_valid_turblence_model(TurbulenceModel turbModel);
 
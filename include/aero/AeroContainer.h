@@ -41,11 +41,22 @@ public:
   void setup(double timeStep, stk::mesh::BulkData& stkBulk);
   void execute(double& timer);
   void init(stk::mesh::BulkData& stkBulk);
+  //! Search the actuator points again after the mesh was redistributed
+  void rebalance(stk::mesh::BulkData& stkBulk);
   void register_nodal_fields(stk::mesh::MetaData& meta, stk::mesh::Part* part);
 
   // TODO active if actuators or FSI is active
   bool is_active() { return has_actuators(); }
 
+  //! Bytes held by the aerodynamic models on this rank
+  size_t memory_bytes() const;
+
+  //! Actuator point and search data, null without actuators
+  const ActuatorBulk* actuator_bulk() const
+  {
+    return actuatorModel_.actBulk_.get();
+  }
+
 private:
   bool has_actuators() { return actuatorModel_.is_active(); }
 #ifdef NALU_USES_OPENFAST
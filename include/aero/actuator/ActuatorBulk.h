@@ -11,8 +11,11 @@
 #define ACTUATORBULK_H_
 
 #include <aero/actuator/ActuatorTypes.h>
+#include <aero/actuator/ActuatorPointHash.h>
 #include <aero/actuator/ActuatorSearch.h>
 #include <Enums.h>
+#include <utils/FieldExchangePlan.h>
+#include <memory>
 #include <vector>
 
 namespace stk {
@@ -48,6 +51,7 @@ struct ActuatorMeta
   stk::search::SearchMethod searchMethod_;
   ActScalarIntDv numPointsTurbine_;
   bool useFLLC_ = false;
+  bool nodeCentricSpreading_ = false;
   ActVectorDblDv epsilonChord_;
   ActVectorDblDv epsilon_;
   ActFixScalarBool entityFLLC_;
@@ -69,10 +73,23 @@ struct ActuatorBulk
     const ActuatorMeta& actMeta, stk::mesh::BulkData& stkBulk);
   void zero_source_terms(stk::mesh::BulkData& stkBulk);
   void parallel_sum_source_term(stk::mesh::BulkData& stkBulk);
+
+  /*! \brief Copy the search results to the device as mesh indices
+   *
+   * Spreading and velocity sampling run on the device only when every
+   * element found by the search, on every rank, is a HEX_8; otherwise
+   * deviceSearch_ is false and the host functors are used. The owned nodes
+   * of the searched elements, used by the node-centric spreading, are
+   * gathered for any topology.
+   */
+  void update_device_search(const stk::mesh::BulkData& stkBulk);
   void compute_offsets(const ActuatorMeta& actMeta);
   Kokkos::RangePolicy<ActuatorFixedExecutionSpace>
   local_range_policy(const ActuatorMeta& actMeta);
 
+  //! Bytes held by the actuator point and search data on this rank
+  virtual size_t memory_bytes() const;
+
   // HOST AND DEVICE DATA (DualViews)
   ActScalarIntDv turbIdOffset_;
   ActVectorDblDv pointCentroid_;
@@ -97,6 +114,26 @@ struct ActuatorBulk
   ActFixScalarInt localParallelRedundancy_;
   ActFixElemIds elemContainingPoint_;
 
+  // DEVICE COPIES OF THE SEARCH RESULTS (see update_device_search)
+  bool deviceSearch_{false};
+  ActMeshIndex coarseSearchElemIndex_;
+  ActMeshIndex elemContainingPointIndex_;
+  ActScalarInt pointIsLocalDevice_;
+  ActScalarInt localParallelRedundancyDevice_;
+  ActVectorDbl localCoordsDevice_;
+
+  //! Unique locally owned nodes of the coarse search elements
+  ActMeshIndex spreadNodeIndex_;
+
+  //! Actuator point binning for SpreadActuatorForceOnNodes
+  ActuatorPointHash pointHash_;
+
+  //! actuator_source was accumulated on the device this step
+  bool sourceOnDevice_{false};
+
+  //! Persistent shared-node sum of actuator_source for the device path
+  std::unique_ptr<FieldExchangePlan> sourceExchangePlan_;
+
   const int localTurbineId_;
 };
 
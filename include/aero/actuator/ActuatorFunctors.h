@@ -37,9 +37,16 @@ struct InterpActuatorVel
   VectorFieldType* velocity_;
 };
 
+//! Sample the velocity at the actuator points on the device
+void InterpActuatorVelNgp(ActuatorBulk& actBulk, stk::mesh::BulkData& stkBulk);
+
 inline void
 RunInterpActuatorVel(ActuatorBulk& actBulk, stk::mesh::BulkData& stkBulk)
 {
+  if (actBulk.deviceSearch_) {
+    InterpActuatorVelNgp(actBulk, stkBulk);
+    return;
+  }
   Kokkos::deep_copy(actBulk.velocity_.view_host(), 0.0);
   actBulk.velocity_.modify_host();
   Kokkos::parallel_for(
@@ -66,6 +73,34 @@ struct SpreadForceInnerLoop
 using SpreadActuatorForce =
   GenericLoopOverCoarseSearchResults<ActuatorBulk, SpreadForceInnerLoop>;
 
+/*! \brief Device version of SpreadActuatorForce
+ *
+ * Loops over the coarse search (point, element) pairs on the device and
+ * atomically adds the Gaussian weighted point force into actuator_source.
+ * Passing the blade orientation tensor gives the anisotropic Gaussian of
+ * ActFastSpreadForceWhProjection. Requires ActuatorBulk::deviceSearch_.
+ */
+void SpreadActuatorForceNgp(
+  ActuatorBulk& actBulk,
+  stk::mesh::BulkData& stkBulk,
+  ActTensorDblDv orientation = ActTensorDblDv());
+
+/*! \brief Node-centric, truncated Gaussian force spreading
+ *
+ * Each owned node of the coarse search elements is visited once and sums the
+ * Gaussian weighted force of every point within that point's search radius,
+ * found through ActuatorBulk::pointHash_. Nodes write their own source term,
+ * so no atomics are needed, and the result does not depend on the element
+ * topology. Inside the search radius this matches SpreadActuatorForce, since
+ * the sub-control volumes around a node sum to its dual volume; beyond it
+ * the kernel is truncated. Passing the orientation tensor gives the
+ * anisotropic Gaussian.
+ */
+void SpreadActuatorForceOnNodes(
+  ActuatorBulk& actBulk,
+  stk::mesh::BulkData& stkBulk,
+  ActTensorDblDv orientation = ActTensorDblDv());
+
 } /* namespace nalu */
 } /* namespace sierra */
 
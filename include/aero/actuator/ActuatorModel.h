@@ -62,6 +62,7 @@ struct ActuatorModel
   void setup(double timeStep, stk::mesh::BulkData& stkBulk);
   void execute(double& timer);
   void init(stk::mesh::BulkData& stkBulk);
+  void rebalance(stk::mesh::BulkData& stkBulk);
   inline bool is_active() { return actMeta_ != nullptr; }
 };
 
@@ -0,0 +1,94 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ACTUATORPOINTHASH_H_
+#define ACTUATORPOINTHASH_H_
+
+#include <aero/actuator/ActuatorTypes.h>
+
+namespace sierra {
+namespace nalu {
+
+/*! \brief Uniform grid hash of the actuator points
+ *
+ * Points are binned into cubic cells whose edge is the largest search radius
+ * and sorted by hashed cell, so every point within its search radius of a
+ * location lies in the 27 cells around that location. The sort key includes
+ * the point id, which keeps the visiting order, and hence the summation order
+ * of the node-centric spreading, independent of the thread schedule.
+ */
+struct ActuatorPointHash
+{
+  using CellView =
+    Kokkos::View<int* [3], ActuatorMemLayout, ActuatorMemSpace>;
+
+  //! Rebuild the hash for the current point positions and search radii
+  void build(const ActVectorDbl& points, const ActScalarDbl& searchRadius);
+
+  size_t memory_bytes() const;
+
+  KOKKOS_INLINE_FUNCTION
+  int cell_index(const double x) const
+  {
+    const double s = x / cellSize_;
+    int c = static_cast<int>(s);
+    if (s < c)
+      --c;
+    return c;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int bucket(const int i, const int j, const int k) const
+  {
+    const unsigned h = (static_cast<unsigned>(i) * 73856093u) ^
+                       (static_cast<unsigned>(j) * 19349663u) ^
+                       (static_cast<unsigned>(k) * 83492791u);
+    return static_cast<int>(h & mask_);
+  }
+
+  /*! \brief Call f(pointId) once for every point binned in the 27 cells
+   * around x; callers still apply their own distance cutoff
+   */
+  template <typename Func>
+  KOKKOS_INLINE_FUNCTION void for_each_point(const double* x, Func f) const
+  {
+    const int c[3] = {cell_index(x[0]), cell_index(x[1]), cell_index(x[2])};
+    for (int i = c[0] - 1; i <= c[0] + 1; ++i) {
+      for (int j = c[1] - 1; j <= c[1] + 1; ++j) {
+        for (int k = c[2] - 1; k <= c[2] + 1; ++k) {
+          const int b = bucket(i, j, k);
+          for (int s = bucketOffsets_(b); s < bucketOffsets_(b + 1); ++s) {
+            // distinct cells can share a bucket; only visit each point once
+            if (
+              sortedCells_(s, 0) == i && sortedCells_(s, 1) == j &&
+              sortedCells_(s, 2) == k)
+              f(sortedPoints_(s));
+          }
+        }
+      }
+    }
+  }
+
+  double cellSize_{1.0};
+  unsigned mask_{0};
+
+  //! point ids sorted by hashed cell
+  ActScalarInt sortedPoints_;
+
+  //! cell of each sorted point
+  CellView sortedCells_;
+
+  //! start of each bucket in sortedPoints_, numBuckets + 1 entries
+  ActScalarInt bucketOffsets_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ACTUATORPOINTHASH_H_ */
@@ -12,6 +12,7 @@
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_DualView.hpp>
+#include <stk_mesh/base/Types.hpp>
 
 namespace sierra {
 namespace nalu {
@@ -57,6 +58,9 @@ using ActTensorDbl =
   Kokkos::View<double* [9], ActuatorMemLayout, ActuatorMemSpace>;
 using Act2DArrayDbl =
   Kokkos::View<double**, ActuatorMemLayout, ActuatorMemSpace>;
+using ActMeshIndex =
+  Kokkos::View<stk::mesh::FastMeshIndex*, ActuatorMemLayout, ActuatorMemSpace>;
+using ActRangePolicy = Kokkos::RangePolicy<ActuatorExecutionSpace>;
 
 // VIEWS FIXED TO HOST
 using ActFixRangePolicy = Kokkos::RangePolicy<ActuatorFixedExecutionSpace>;
@@ -75,6 +79,40 @@ using ActFixArrayInt =
 using ActFixTensorDbl =
   Kokkos::View<double* [9], ActuatorFixedMemLayout, ActuatorFixedMemSpace>;
 
+//! Bytes allocated by a view
+template <typename T>
+inline size_t
+act_view_bytes(const T& view)
+{
+  return view.span() * sizeof(typename T::value_type);
+}
+
+//! Bytes allocated by both sides of a dual view (counted once if aliased)
+template <typename T>
+inline size_t
+act_dual_view_bytes(const T& dualView)
+{
+  size_t bytes = act_view_bytes(dualView.d_view);
+  if (dualView.h_view.data() != dualView.d_view.data())
+    bytes += act_view_bytes(dualView.h_view);
+  return bytes;
+}
+
+/** Copy the host side of a per-point dual view to the device
+ *
+ *  The per-point actuator arrays are filled on the host and are not always
+ *  marked as modified, so the host copy is treated as authoritative.
+ */
+template <typename T>
+inline auto
+act_host_to_device(T dualView) -> decltype(dualView.view_device())
+{
+  if (dualView.view_host().data() != dualView.view_device().data())
+    Kokkos::deep_copy(dualView.view_device(), dualView.view_host());
+  dualView.clear_sync_state();
+  return dualView.view_device();
+}
+
 template <typename memory_space>
 struct ActDualViewHelper
 {
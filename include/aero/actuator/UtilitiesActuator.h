@@ -23,6 +23,7 @@
 #include <stk_mesh/base/MetaData.hpp>
 #include <stk_mesh/base/Part.hpp>
 #include <stk_search/Point.hpp>
+#include <stk_math/StkMath.hpp>
 #ifdef NALU_USES_OPENFAST
 #include <OpenFAST.H>
 #endif
@@ -113,6 +114,18 @@ double Gaussian_projection(int nDim, double* dis, const Coordinates& epsilon);
 // A Gaussian projection function
 double Gaussian_projection(int nDim, double* dis, double* epsilon);
 
+// A three dimensional Gaussian projection function callable on the device
+KOKKOS_INLINE_FUNCTION
+double
+Gaussian_projection_3d(const double* dis, const double* epsilon)
+{
+  const double x = dis[0] / epsilon[0];
+  const double y = dis[1] / epsilon[1];
+  const double z = dis[2] / epsilon[2];
+  return stk::math::exp(-(x * x + y * y + z * z)) /
+         (epsilon[0] * epsilon[1] * epsilon[2] * M_PI * stk::math::sqrt(M_PI));
+}
+
 void resize_std_vector(
   const int& sizeOfField,
   std::vector<double>& theVector,
@@ -427,6 +427,31 @@ public:
     return referenceGradWeights_;
   }
 
+  const GradWeightType& shifted_shape_function_derivatives()
+  {
+    return shiftedReferenceGradWeights_;
+  }
+
+  // sum-factorized counterparts of generic_grad_op, weighted_area_vectors
+  // and generic_gij_3d: the Jacobian is contracted one direction at a time
+  // with the 1D basis instead of with the dense ip x node tables
+  template <typename CoordViewType, typename OutputViewType>
+  KOKKOS_FUNCTION void tensor_product_grad_op(
+    const CoordViewType& coords,
+    OutputViewType& gradop,
+    OutputViewType& deriv,
+    bool shifted = false) const;
+
+  template <typename CoordViewType, typename OutputViewType>
+  KOKKOS_FUNCTION void tensor_product_area_vectors(
+    const CoordViewType& coords, OutputViewType& areav) const;
+
+  template <typename CoordViewType, typename OutputViewType>
+  KOKKOS_FUNCTION void tensor_product_gij(
+    const CoordViewType& coords,
+    OutputViewType& gupper,
+    OutputViewType& glower) const;
+
   template <
     typename GradViewType,
     typename CoordViewType,
@@ -499,6 +524,25 @@ private:
 
   void set_interior_info();
   void set_boundary_info();
+  void set_tensor_product_info();
+
+  // 1D points: the gauss points of the three sub-segments followed by the
+  // two scs locations
+  static constexpr int numGaussPoints1D_ = nodes1D_ * numQuad_; // 6
+  static constexpr int numPoints1D_ = numGaussPoints1D_ + 2;    // 8
+
+  // 1D basis values and derivatives for the standard [0] and shifted [1] ips
+  double basis1D_[2][numPoints1D_][nodes1D_];
+  double deriv1D_[2][numPoints1D_][nodes1D_];
+
+  // ip ordinal for (normal direction, scs, gauss point along the first and
+  // second in-plane directions)
+  int planeIpMap_[nDim_][2][numGaussPoints1D_][numGaussPoints1D_];
+
+  template <typename CoordViewType, typename Function>
+  KOKKOS_FUNCTION void
+  sum_factorized_jacobians(const CoordViewType& coords, int set, Function f)
+    const;
 
   template <Jacobian::Direction dir>
   void area_vector(
@@ -572,18 +616,221 @@ KOKKOS_FUNCTION void
 Hex27SCS::grad_op(
   ViewTypeCoord& coords, ViewTypeGrad& gradop, ViewTypeGrad& deriv)
 {
-  generic_grad_op<AlgTraits>(referenceGradWeights_, coords, gradop);
+  tensor_product_grad_op(coords, gradop, deriv);
+}
 
-  // copy derivs as well.  These aren't used, but are part of the interface
-  for (int ip = 0; ip < AlgTraits::numScsIp_; ++ip) {
-    for (int n = 0; n < AlgTraits::nodesPerElement_; ++n) {
-      for (int d = 0; d < AlgTraits::nDim_; ++d) {
-        deriv(ip, n, d) = referenceGradWeights_(ip, n, d);
+template <typename CoordViewType, typename Function>
+KOKKOS_FUNCTION void
+Hex27SCS::sum_factorized_jacobians(
+  const CoordViewType& coords, int set, Function f) const
+{
+  using ftype = typename CoordViewType::value_type;
+  static_assert(CoordViewType::Rank == 2, "Coordinate view assumed to be 2D");
+
+  constexpr int n1D = nodes1D_;
+  const auto& phi = basis1D_[set];
+  const auto& dphi = deriv1D_[set];
+
+  for (int nrm = 0; nrm < nDim_; ++nrm) {
+    // in-plane directions, in increasing order
+    const int p1 = (nrm == 0) ? 1 : 0;
+    const int p2 = (nrm == 2) ? 1 : 2;
+
+    for (int m = 0; m < 2; ++m) {
+      const int qn = numGaussPoints1D_ + m;
+
+      // contract the normal direction onto the scs
+      NALU_ALIGNED ftype x[nDim_][n1D][n1D];
+      NALU_ALIGNED ftype dx_dn[nDim_][n1D][n1D];
+      for (int j = 0; j < n1D; ++j) {
+        for (int i = 0; i < n1D; ++i) {
+          for (int c = 0; c < nDim_; ++c) {
+            x[c][j][i] = ftype(0.0);
+            dx_dn[c][j][i] = ftype(0.0);
+          }
+          int ijk[nDim_];
+          ijk[p1] = i;
+          ijk[p2] = j;
+          for (int r = 0; r < n1D; ++r) {
+            ijk[nrm] = r;
+            const int n = stkNodeMap_[ijk[2]][ijk[1]][ijk[0]];
+            for (int c = 0; c < nDim_; ++c) {
+              x[c][j][i] += phi[qn][r] * coords(n, c);
+              dx_dn[c][j][i] += dphi[qn][r] * coords(n, c);
+            }
+          }
+        }
+      }
+
+      for (int b = 0; b < numGaussPoints1D_; ++b) {
+        // contract the second in-plane direction
+        NALU_ALIGNED ftype y[nDim_][n1D];
+        NALU_ALIGNED ftype dy_dp2[nDim_][n1D];
+        NALU_ALIGNED ftype dy_dn[nDim_][n1D];
+        for (int c = 0; c < nDim_; ++c) {
+          for (int i = 0; i < n1D; ++i) {
+            y[c][i] = ftype(0.0);
+            dy_dp2[c][i] = ftype(0.0);
+            dy_dn[c][i] = ftype(0.0);
+            for (int j = 0; j < n1D; ++j) {
+              y[c][i] += phi[b][j] * x[c][j][i];
+              dy_dp2[c][i] += dphi[b][j] * x[c][j][i];
+              dy_dn[c][i] += phi[b][j] * dx_dn[c][j][i];
+            }
+          }
+        }
+
+        // and finally the first in-plane direction
+        for (int a = 0; a < numGaussPoints1D_; ++a) {
+          NALU_ALIGNED ftype jac[nDim_][nDim_];
+          for (int c = 0; c < nDim_; ++c) {
+            jac[c][p1] = ftype(0.0);
+            jac[c][p2] = ftype(0.0);
+            jac[c][nrm] = ftype(0.0);
+            for (int i = 0; i < n1D; ++i) {
+              jac[c][p1] += dphi[a][i] * y[c][i];
+              jac[c][p2] += phi[a][i] * dy_dp2[c][i];
+              jac[c][nrm] += phi[a][i] * dy_dn[c][i];
+            }
+          }
+
+          int q[nDim_];
+          q[nrm] = qn;
+          q[p1] = a;
+          q[p2] = b;
+          f(planeIpMap_[nrm][m][a][b], jac, q);
+        }
       }
     }
   }
 }
 
+template <typename CoordViewType, typename OutputViewType>
+KOKKOS_FUNCTION void
+Hex27SCS::tensor_product_grad_op(
+  const CoordViewType& coords,
+  OutputViewType& gradop,
+  OutputViewType& deriv,
+  bool shifted) const
+{
+  using ftype = typename CoordViewType::value_type;
+  static_assert(
+    std::is_same<ftype, typename OutputViewType::value_type>::value,
+    "Incompatiable value type for views");
+  static_assert(OutputViewType::Rank == 3, "grad view assumed to be 3D");
+
+  const int set = shifted ? 1 : 0;
+  const auto& phi = basis1D_[set];
+  const auto& dphi = deriv1D_[set];
+
+  sum_factorized_jacobians(
+    coords, set, [&](int ip, const ftype jac[][3], const int* q) {
+      NALU_ALIGNED ftype adjJac[nDim_][nDim_];
+      cofactorMatrix(adjJac, jac);
+
+      NALU_ALIGNED ftype det = ftype(0.0);
+      for (int i = 0; i < nDim_; ++i)
+        det += jac[i][0] * adjJac[i][0];
+      ThrowAssertMsg(
+        stk::simd::are_any(det > tiny_positive_value()),
+        "Problem with Jacobian determinant");
+      NALU_ALIGNED const ftype inv_detj = ftype(1.0) / det;
+
+      for (int k = 0; k < nodes1D_; ++k) {
+        for (int j = 0; j < nodes1D_; ++j) {
+          for (int i = 0; i < nodes1D_; ++i) {
+            const int n = stkNodeMap_[k][j][i];
+            const double refGrad[nDim_] = {
+              dphi[q[0]][i] * phi[q[1]][j] * phi[q[2]][k],
+              phi[q[0]][i] * dphi[q[1]][j] * phi[q[2]][k],
+              phi[q[0]][i] * phi[q[1]][j] * dphi[q[2]][k]};
+
+            for (int d = 0; d < nDim_; ++d) {
+              deriv(ip, n, d) = refGrad[d];
+              gradop(ip, n, d) =
+                inv_detj *
+                (adjJac[d][0] * refGrad[0] + adjJac[d][1] * refGrad[1] +
+                 adjJac[d][2] * refGrad[2]);
+            }
+          }
+        }
+      }
+    });
+}
+
+template <typename CoordViewType, typename OutputViewType>
+KOKKOS_FUNCTION void
+Hex27SCS::tensor_product_area_vectors(
+  const CoordViewType& coords, OutputViewType& areav) const
+{
+  using ftype = typename CoordViewType::value_type;
+  static_assert(
+    std::is_same<ftype, typename OutputViewType::value_type>::value,
+    "Incompatiable value type for views");
+  static_assert(OutputViewType::Rank == 2, "areav view assumed to be 2D");
+
+  sum_factorized_jacobians(
+    coords, 0, [&](int ip, const ftype jac[][3], const int*) {
+      // same surface parameterization as area_vector<direction>
+      const int direction = ipInfo_[ip].direction;
+      const int s1 = (direction == Jacobian::T_DIRECTION)
+                       ? Jacobian::S_DIRECTION
+                       : Jacobian::T_DIRECTION;
+      const int s2 = (direction == Jacobian::U_DIRECTION)
+                       ? Jacobian::S_DIRECTION
+                       : Jacobian::U_DIRECTION;
+
+      const double weight = ipInfo_[ip].weight;
+      areav(ip, 0) =
+        weight * (jac[1][s1] * jac[2][s2] - jac[2][s1] * jac[1][s2]);
+      areav(ip, 1) =
+        weight * (jac[2][s1] * jac[0][s2] - jac[0][s1] * jac[2][s2]);
+      areav(ip, 2) =
+        weight * (jac[0][s1] * jac[1][s2] - jac[1][s1] * jac[0][s2]);
+    });
+}
+
+template <typename CoordViewType, typename OutputViewType>
+KOKKOS_FUNCTION void
+Hex27SCS::tensor_product_gij(
+  const CoordViewType& coords,
+  OutputViewType& gup,
+  OutputViewType& glo) const
+{
+  using ftype = typename CoordViewType::value_type;
+  static_assert(
+    std::is_same<ftype, typename OutputViewType::value_type>::value,
+    "Incompatiable value type for views");
+  static_assert(OutputViewType::Rank == 3, "gij view assumed to be 3D");
+
+  sum_factorized_jacobians(
+    coords, 0, [&](int ip, const ftype jac[][3], const int*) {
+      for (int i = 0; i < nDim_; ++i) {
+        for (int j = i; j < nDim_; ++j) {
+          gup(ip, i, j) = jac[i][0] * jac[j][0] + jac[i][1] * jac[j][1] +
+                          jac[i][2] * jac[j][2];
+          gup(ip, j, i) = gup(ip, i, j);
+        }
+      }
+
+      // the covariant is the inverse of the contravariant by definition
+      NALU_ALIGNED ftype adjGup[nDim_][nDim_];
+      NALU_ALIGNED ftype g[nDim_][nDim_];
+      for (int i = 0; i < nDim_; ++i)
+        for (int j = 0; j < nDim_; ++j)
+          g[i][j] = gup(ip, i, j);
+      cofactorMatrix(adjGup, g);
+
+      NALU_ALIGNED const ftype inv_detj =
+        ftype(1.0) /
+        (g[0][0] * adjGup[0][0] + g[0][1] * adjGup[0][1] +
+         g[0][2] * adjGup[0][2]);
+      for (int i = 0; i < nDim_; ++i)
+        for (int j = 0; j < nDim_; ++j)
+          glo(ip, i, j) = inv_detj * adjGup[i][j];
+    });
+}
+
 } // namespace nalu
 } // namespace sierra
 
@@ -10,11 +10,16 @@
 #ifndef MATRIX_FREE_SOLVER_H
 #define MATRIX_FREE_SOLVER_H
 
+#include "matrix_free/PipelinedCG.h"
+
 #include "BelosTpetraAdapter.hpp"
 #include "BelosLinearProblem.hpp"
 #include "Tpetra_MultiVector.hpp"
 #include "Tpetra_Operator.hpp"
 
+#include <memory>
+#include <ostream>
+
 namespace Teuchos {
 class ParameterList;
 }
@@ -52,14 +57,26 @@ public:
   double final_linear_norm() const;
   int num_iterations() const;
 
+  //! Number of global reductions issued by the last solve
+  //! (only tracked for the pipelined solvers)
+  int num_reductions() const;
+
+  //! Time spent waiting on global reductions during the last solve
+  double reduction_wait_time() const;
+
 private:
   mv_type lhs_vector_;
   mv_type rhs_vector_;
   mutable mv_type final_rhs_vector_;
   problem_type problem_;
   Teuchos::RCP<Belos::SolverManager<double, mv_type, base_op_type>> solv_;
+  std::unique_ptr<PipelinedCG> pipelined_cg_;
 };
 
+/** Report the global reductions issued by the last solve, if tracked
+ */
+void reduction_banner(const MatrixFreeSolver& solver, std::ostream& stream);
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
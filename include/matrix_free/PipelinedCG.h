@@ -0,0 +1,91 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PIPELINED_CG_H
+#define PIPELINED_CG_H
+
+#include "Kokkos_Core.hpp"
+#include "Tpetra_MultiVector.hpp"
+#include "Tpetra_Operator.hpp"
+
+#include "mpi.h"
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+/** Preconditioned conjugate gradient with a single, non-blocking reduction
+ *  per iteration (Ghysels & Vanroose, 2014)
+ *
+ *  The three inner products of an iteration are fused into one
+ *  MPI_Iallreduce that is overlapped with the preconditioner and operator
+ *  apply. Only valid for symmetric positive definite operators, i.e. the
+ *  conduction and continuity systems. Each column of a multivector is solved
+ *  as an independent system.
+ */
+class PipelinedCG
+{
+public:
+  using op_type = Tpetra::Operator<>;
+  using mv_type = Tpetra::MultiVector<>;
+  static constexpr int max_vectors = 3;
+
+  PipelinedCG(
+    const op_type& op,
+    int num_vectors,
+    double tolerance,
+    int max_iterations);
+
+  void set_preconditioner(const op_type& prec) { prec_ = &prec; }
+
+  //! Solve op x = b, using the incoming x as the initial guess
+  void solve(const mv_type& b, mv_type& x);
+
+  int num_iterations() const { return num_iterations_; }
+  int num_reductions() const { return num_reductions_; }
+
+  //! Time spent waiting on the global reductions during the last solve
+  double reduction_wait_time() const { return reduction_wait_time_; }
+
+private:
+  void start_reduction();
+  void finish_reduction();
+  void apply_preconditioner(const mv_type& x, mv_type& y) const;
+
+  const op_type& op_;
+  const op_type* prec_{nullptr};
+  const int num_vectors_;
+  const double tolerance_;
+  const int max_iterations_;
+  MPI_Comm comm_;
+
+  mv_type r_;
+  mv_type u_;
+  mv_type w_;
+  mv_type m_;
+  mv_type n_;
+  mv_type z_;
+  mv_type q_;
+  mv_type s_;
+  mv_type p_;
+
+  // (r,u), (w,u), (r,r) for each column
+  Kokkos::View<double*, Kokkos::HostSpace> local_dots_;
+  Kokkos::View<double*, Kokkos::HostSpace> global_dots_;
+  MPI_Request request_{MPI_REQUEST_NULL};
+
+  int num_iterations_{0};
+  int num_reductions_{0};
+  double reduction_wait_time_{0};
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+#endif
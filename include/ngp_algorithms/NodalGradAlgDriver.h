@@ -16,6 +16,8 @@
 namespace sierra {
 namespace nalu {
 
+class FieldExchangePlan;
+
 template <typename GradPhiType>
 class NodalGradAlgDriver : public NgpAlgDriver
 {
@@ -35,9 +37,27 @@ public:
   //! Synchronize fields after algorithms have done their work
   virtual void post_work() override;
 
+  /** Run the algorithms and only start the shared-node exchange
+   *
+   *  The gradient must not be read until finish_exchange() is called, which
+   *  allows independent work to proceed while the messages are in flight.
+   */
+  void execute_and_start_exchange();
+
+  //! Complete the exchange and the periodic/overset updates
+  void finish_exchange();
+
 private:
+  void start_exchange();
+
   //! Field that is synchronized pre/post updates
   const std::string gradPhiName_;
+
+  //! Plan with an exchange in flight, if any
+  FieldExchangePlan* inFlight_{nullptr};
+
+  //! Defer finish_exchange() out of post_work()
+  bool deferFinish_{false};
 };
 
 using ScalarNodalGradAlgDriver = NodalGradAlgDriver<VectorFieldType>;
@@ -25,7 +25,12 @@ class Realm;
  *  provides an additional functionality to compute an area-weighted average of
  *  the friction velocity (utau) that is used in the BdyLayerStatistics class.
  *
- *  \sa ABLWallFrictionVelAlg, BdyLayerStatistics
+ *  For the engineering wall function, the driver also owns the nodal wall
+ *  area and wall normal distance assembled by WallFrictionVelAlg on the parts
+ *  registered through add_wall_geometry_part. They are zeroed before and
+ *  parallel assembled and normalized after the algorithms execute.
+ *
+ *  \sa ABLWallFrictionVelAlg, WallFrictionVelAlg, BdyLayerStatistics
  */
 class WallFricVelAlgDriver : public NgpAlgDriver
 {
@@ -54,7 +59,27 @@ public:
     utauAreaSum_[1] += area_sum;
   }
 
+  //! Accumulate the number of integration points whose utau solve failed
+  inline void accumulate_utau_not_converged(const DoubleType& count)
+  {
+    utauNotConverged_ += count;
+  }
+
+  //! Assemble the nodal wall geometry fields on this part
+  void add_wall_geometry_part(stk::mesh::Part* part)
+  {
+    wallGeomParts_.push_back(part);
+  }
+
 private:
+  void assemble_wall_geometry();
+
+  //! Report the global number of non-converged utau solves on rank 0
+  void report_not_converged();
+
+  //! Parts whose nodal wall geometry is assembled by this driver
+  stk::mesh::PartVector wallGeomParts_;
+
   /** Accumulator for area-weighted friction-velocity average
    *
    *  The first entry stores the (utau * area) sum
@@ -63,6 +88,9 @@ private:
    *  utau_average = (utau * area) / total_area;
    */
   DoubleType utauAreaSum_[2];
+
+  //! Number of integration points whose utau Newton solve did not converge
+  DoubleType utauNotConverged_{0.0};
 };
 
 } // namespace nalu
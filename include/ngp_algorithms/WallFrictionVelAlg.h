@@ -0,0 +1,96 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef WALLFRICTIONVELALG_H
+#define WALLFRICTIONVELALG_H
+
+#include "Algorithm.h"
+#include "ElemDataRequests.h"
+#include "SimdInterface.h"
+
+#include "ngp_algorithms/WallFricVelAlgDriver.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+/** Compute the wall friction velocity for the engineering wall function
+ *
+ *  The wall normal distance at the integration points is approximated by a
+ *  quarter of the distance to the opposing element node (or set to the
+ *  roughness height for the RANS ABL approach) and the friction velocity is
+ *  obtained from a per integration point Newton solve of the log law. The
+ *  nodal wall area and wall normal distance are accumulated for the
+ *  WallFricVelAlgDriver to assemble.
+ *
+ *  \sa WallFricVelAlgDriver, ABLWallFrictionVelAlg
+ */
+template <typename BcAlgTraits>
+class WallFrictionVelAlg : public Algorithm
+{
+public:
+  using DblType = double;
+
+  WallFrictionVelAlg(
+    Realm&,
+    stk::mesh::Part*,
+    WallFricVelAlgDriver&,
+    const bool,
+    const bool,
+    const double,
+    const double,
+    const double);
+
+  virtual ~WallFrictionVelAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  WallFricVelAlgDriver& algDriver_;
+
+  ElemDataRequests faceData_;
+  ElemDataRequests elemData_;
+
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned velocityNp1_{stk::mesh::InvalidOrdinal};
+  unsigned bcVelocity_{stk::mesh::InvalidOrdinal};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned viscosity_{stk::mesh::InvalidOrdinal};
+  unsigned exposedAreaVec_{stk::mesh::InvalidOrdinal};
+  unsigned wallFricVel_{stk::mesh::InvalidOrdinal};
+  unsigned wallNormDistBip_{stk::mesh::InvalidOrdinal};
+  unsigned wallArea_{stk::mesh::InvalidOrdinal};
+  unsigned wallNormDist_{stk::mesh::InvalidOrdinal};
+
+  //! Fraction of the distance to the opposing node used as y_p
+  static constexpr DblType wallNormalHeightFactor{0.25};
+
+  const DblType yplusCrit_{11.63};
+  const DblType elog_{9.8};
+  const DblType kappa_;
+  const int maxIteration_{20};
+  const DblType tolerance_{1.0e-6};
+
+  const bool useShifted_{false};
+  const bool RANSAblBcApproach_{false};
+
+  //! Reference velocity, height and roughness height for the RANS ABL approach
+  const DblType uRef_;
+  const DblType zRef_;
+  const DblType z0_;
+
+  MasterElement* meFC_{nullptr};
+  MasterElement* meSCS_{nullptr};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* WALLFRICTIONVELALG_H */
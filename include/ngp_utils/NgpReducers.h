@@ -115,6 +115,112 @@ public:
   bool references_scalar() const { return references_scalar_v; }
 };
 
+/** Value type for ArraySumMinMax: N summed entries plus a min and a max
+ */
+template <class Scalar, int N>
+struct ArraySumMinMaxScalar
+{
+  Scalar sum_val[N];
+  Scalar min_val, max_val;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  ArraySumMinMaxScalar() = default;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  ArraySumMinMaxScalar(const ArraySumMinMaxScalar&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator=(const ArraySumMinMaxScalar& rhs)
+  {
+    for (int i = 0; i < N; ++i)
+      sum_val[i] = rhs.sum_val[i];
+    min_val = rhs.min_val;
+    max_val = rhs.max_val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator=(const volatile ArraySumMinMaxScalar& rhs) volatile
+  {
+    for (int i = 0; i < N; ++i)
+      sum_val[i] = rhs.sum_val[i];
+    min_val = rhs.min_val;
+    max_val = rhs.max_val;
+  }
+};
+
+/** Reduce N sums along with the min and max of one more quantity in a single
+ *  parallel_reduce, e.g., integrated surface forces and the y+ range
+ */
+template <class Scalar, int N, class Space = Kokkos::HostSpace>
+struct ArraySumMinMax
+{
+private:
+  typedef typename std::remove_cv<Scalar>::type scalar_type;
+
+public:
+  typedef ArraySumMinMax reducer;
+  typedef ArraySumMinMaxScalar<scalar_type, N> value_type;
+  typedef Kokkos::View<value_type, Space> result_view_type;
+
+private:
+  result_view_type value;
+  bool references_scalar_v;
+
+public:
+  KOKKOS_INLINE_FUNCTION
+  ArraySumMinMax(value_type& value_)
+    : value(&value_), references_scalar_v(true)
+  {
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ArraySumMinMax(const result_view_type& value_)
+    : value(value_), references_scalar_v(false)
+  {
+  }
+
+  // Required
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& dest, const value_type& src) const
+  {
+    for (int i = 0; i < N; ++i)
+      dest.sum_val[i] += src.sum_val[i];
+    if (src.min_val < dest.min_val)
+      dest.min_val = src.min_val;
+    if (src.max_val > dest.max_val)
+      dest.max_val = src.max_val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& dest, const volatile value_type& src) const
+  {
+    for (int i = 0; i < N; ++i)
+      dest.sum_val[i] += src.sum_val[i];
+    if (src.min_val < dest.min_val)
+      dest.min_val = src.min_val;
+    if (src.max_val > dest.max_val)
+      dest.max_val = src.max_val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& val) const
+  {
+    for (int i = 0; i < N; ++i)
+      val.sum_val[i] = Kokkos::reduction_identity<scalar_type>::sum();
+    val.min_val = Kokkos::reduction_identity<scalar_type>::min();
+    val.max_val = Kokkos::reduction_identity<scalar_type>::max();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  value_type& reference() const { return *value.data(); }
+
+  KOKKOS_INLINE_FUNCTION
+  result_view_type view() const { return value; }
+
+  KOKKOS_INLINE_FUNCTION
+  bool references_scalar() const { return references_scalar_v; }
+};
+
 } // namespace nalu_ngp
 
 } // namespace nalu
@@ -0,0 +1,58 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ENTHALPYLOWSPEEDCOMPRESSIBLENODEKERNEL_H
+#define ENTHALPYLOWSPEEDCOMPRESSIBLENODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+//! Low speed compressible source term, dp/dt, for the enthalpy equation
+class EnthalpyLowSpeedCompressibleNodeKernel
+  : public NGPNodeKernel<EnthalpyLowSpeedCompressibleNodeKernel>
+{
+public:
+  EnthalpyLowSpeedCompressibleNodeKernel(const stk::mesh::BulkData&);
+
+  EnthalpyLowSpeedCompressibleNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~EnthalpyLowSpeedCompressibleNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&) override;
+
+private:
+  stk::mesh::NgpField<double> dualNodalVolume_;
+  stk::mesh::NgpField<double> pressureN_;
+  stk::mesh::NgpField<double> pressureNp1_;
+
+  unsigned dualNodalVolumeID_{stk::mesh::InvalidOrdinal};
+  unsigned pressureNID_{stk::mesh::InvalidOrdinal};
+  unsigned pressureNp1ID_{stk::mesh::InvalidOrdinal};
+
+  NodeKernelTraits::DblType dt_{0.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ENTHALPYPMRSRCNODEKERNEL_H
+#define ENTHALPYPMRSRCNODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+//! Participating media radiation source term for the enthalpy equation;
+//! explicit coupling through the divergence of the radiative heat flux
+class EnthalpyPmrSrcNodeKernel : public NGPNodeKernel<EnthalpyPmrSrcNodeKernel>
+{
+public:
+  EnthalpyPmrSrcNodeKernel(const stk::mesh::BulkData&);
+
+  EnthalpyPmrSrcNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~EnthalpyPmrSrcNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&) override;
+
+private:
+  stk::mesh::NgpField<double> dualNodalVolume_;
+  stk::mesh::NgpField<double> divRadFlux_;
+
+  unsigned dualNodalVolumeID_{stk::mesh::InvalidOrdinal};
+  unsigned divRadFluxID_{stk::mesh::InvalidOrdinal};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
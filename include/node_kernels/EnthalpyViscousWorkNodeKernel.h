@@ -0,0 +1,65 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ENTHALPYVISCOUSWORKNODEKERNEL_H
+#define ENTHALPYVISCOUSWORKNODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class SolutionOptions;
+
+/** Viscous work source term, tau_ij du_i/dx_j, for the enthalpy equation
+ *
+ *  Uses the effective viscosity for turbulent flows
+ */
+class EnthalpyViscousWorkNodeKernel
+  : public NGPNodeKernel<EnthalpyViscousWorkNodeKernel>
+{
+public:
+  EnthalpyViscousWorkNodeKernel(
+    const stk::mesh::BulkData&, const SolutionOptions&);
+
+  EnthalpyViscousWorkNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~EnthalpyViscousWorkNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&) override;
+
+private:
+  stk::mesh::NgpField<double> dualNodalVolume_;
+  stk::mesh::NgpField<double> dudx_;
+  stk::mesh::NgpField<double> viscosity_;
+
+  unsigned dualNodalVolumeID_{stk::mesh::InvalidOrdinal};
+  unsigned dudxID_{stk::mesh::InvalidOrdinal};
+  unsigned viscosityID_{stk::mesh::InvalidOrdinal};
+
+  const int nDim_;
+  const NodeKernelTraits::DblType includeDivU_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
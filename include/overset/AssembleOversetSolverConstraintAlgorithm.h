@@ -38,6 +38,9 @@ public:
   virtual void execute();
 
 private:
+  //! Host assembly through LinearSystem::sumInto; used for Hypre systems
+  void execute_host();
+
   AssembleOversetSolverConstraintAlgorithm() = delete;
   AssembleOversetSolverConstraintAlgorithm(
     const AssembleOversetSolverConstraintAlgorithm&) = delete;
@@ -47,6 +47,8 @@ class OversetManager
 public:
   using EntityList =
     Kokkos::View<stk::mesh::Entity*, Kokkos::LayoutRight, MemSpace>;
+  using OffsetList = Kokkos::View<int*, Kokkos::LayoutRight, MemSpace>;
+  using WeightList = Kokkos::View<double*, Kokkos::LayoutRight, MemSpace>;
 
   OversetManager(Realm& realm);
 
@@ -86,6 +88,18 @@ public:
 
   virtual void reset_data_structures();
 
+  /** Flatten the locally owned {fringe node, donor element} pairs into device
+   *  views for the constraint assembly
+   *
+   *  Must be called after oversetInfoVec_ has been populated for the current
+   *  connectivity.
+   */
+  void update_ngp_constraint_data();
+
+  /** Bytes held by the fringe/hole bookkeeping on this rank
+   */
+  virtual size_t memory_bytes() const;
+
   Realm& realm_;
 
   stk::mesh::MetaData* metaData_{nullptr};
@@ -102,6 +116,19 @@ public:
   EntityList ngpHoleNodes_;
   EntityList ngpFringeNodes_;
 
+  /** Constraint stencils of the locally owned fringe nodes
+   *
+   *  Entries [ngpConstraintOffsets_(i), ngpConstraintOffsets_(i+1)) hold the
+   *  fringe node followed by the nodes of its donor element, along with the
+   *  donor shape function weights (zero for the fringe node itself).
+   */
+  OffsetList ngpConstraintOffsets_;
+  EntityList ngpConstraintNodes_;
+  WeightList ngpConstraintWeights_;
+
+  //! Largest stencil (fringe node + donor nodes) in the constraint views
+  int maxConstraintNodes_{0};
+
   std::vector<int> ghostCommProcs_;
 
   //! Timer for overset connectivity
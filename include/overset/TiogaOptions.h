@@ -55,6 +55,25 @@ public:
    */
   bool adjust_resolutions() const { return adjustResolutionsForFringes_; }
 
+  /** Reuse the previous {fringe node, donor element} pairs while every
+   *  donor still contains its fringe node
+   *
+   *  All or nothing: one stale donor on any rank forces a full connectivity
+   *  update for all receptors.
+   */
+  bool incremental_connectivity() const { return incrementalConnectivity_; }
+
+  //! Maximum number of consecutive incremental updates before a full
+  //! connectivity update is forced
+  int max_incremental_steps() const { return maxIncrementalSteps_; }
+
+  //! Largest fringe node displacement since the last full update, as a
+  //! fraction of the donor element size, that still allows reuse
+  double max_incremental_displacement() const
+  {
+    return maxIncrementalDisplacement_;
+  }
+
   double cell_res_mult() const { return cellResMult_; }
   double node_res_mult() const { return nodeResMult_; }
 
@@ -98,6 +117,17 @@ private:
   //! Flag indicating whether the node/cell resolutions should be adjusted for
   //! mandatory fringes
   bool adjustResolutionsForFringes_{true};
+
+  //! Skip the TIOGA connectivity when the previous donors remain valid
+  bool incrementalConnectivity_{false};
+
+  //! The hole cut is only recomputed by a full update, so bound the number of
+  //! steps it can lag behind the mesh motion
+  int maxIncrementalSteps_{10};
+
+  //! The hole cut was computed for the mesh position at the last full update;
+  //! force a full update once the body has moved a fraction of a donor cell
+  double maxIncrementalDisplacement_{0.5};
 };
 
 } // namespace tioga_nalu
@@ -98,6 +98,21 @@ private:
    */
   void update_ghosting();
 
+  /** Attempt to reuse the connectivity from the previous update
+   *
+   *  Recomputes the iso-parametric coordinates of every fringe node within its
+   *  previous donor element at the current mesh coordinates. If all donors
+   *  across all ranks still contain their fringe nodes, and no fringe node has
+   *  moved more than TiogaOptions::max_incremental_displacement since the
+   *  last full update, the overset info is updated in place and the TIOGA
+   *  hole cut and donor search are skipped. Otherwise nothing is reused:
+   *  failed receptors are not searched on their own, and the caller
+   *  performs a full update of all receptors and of the donor ghosting.
+   *
+   *  \return true if the previous connectivity was reused
+   */
+  bool incremental_update();
+
   /** Reset all connectivity data structures when recomputing connectivity
    */
   void reset_data_structures();
@@ -156,6 +171,13 @@ private:
 
   //! Name of the coordinates field (for moving mesh simulations)
   std::string coordsName_;
+
+  //! Number of consecutive connectivity updates that reused the donors
+  int numIncrementalSteps_{0};
+
+  //! Fringe node coordinates at the last full update, ordered as
+  //! OversetManager::oversetInfoVec_
+  std::vector<double> fullUpdateCoords_;
 };
 
 } // namespace tioga_nalu
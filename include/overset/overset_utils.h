@@ -11,9 +11,18 @@
 #define OVERSET_UTILS_H
 
 #include "overset/OversetFieldData.h"
+
+#include "stk_mesh/base/Types.hpp"
+
 #include <vector>
 #include <string>
 
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+} // namespace stk
+
 namespace sierra {
 namespace nalu {
 
@@ -24,7 +33,43 @@ namespace overset_utils {
 std::vector<OversetFieldData>
 get_overset_field_data(Realm&, std::vector<std::string> fnames);
 
-}
+/** Check whether a fringe node has moved little enough to keep its donor
+ *
+ *  \param elemCoords Donor element coordinates laid out as [nDim][numNodes]
+ *  \param x Current fringe node coordinates
+ *  \param xRef Fringe node coordinates at the last full connectivity update
+ *  \param maxFraction Allowed displacement as a fraction of the smallest
+ *         extent of the donor element bounding box
+ */
+bool fringe_displacement_within_tolerance(
+  const double* elemCoords,
+  const int numNodes,
+  const int nDim,
+  const double* x,
+  const double* xRef,
+  const double maxFraction);
+
+/** Reconcile fringe status mismatches across shared nodes
+ *
+ *  Sends each {receptor node, donor element} pair only to the sharing rank
+ *  that must also mark the node as fringe, and asks the owner of the donor
+ *  element to ghost it to that rank. Donors owned by this rank are added to
+ *  the ghosting requests directly.
+ *
+ *  \param nodesToReset (proc, nodeID, donorID) triples detected on this rank
+ *  \param elemsToGhost Ghosting requests of the donor elements owned by this
+ *         rank; appended to
+ *  \param receptorIDs Receptor nodes of the pairs received; appended to
+ *  \param donorIDs Donor elements of the pairs received; appended to
+ */
+void reconcile_receptor_info(
+  const stk::mesh::BulkData& bulk,
+  const std::vector<unsigned long>& nodesToReset,
+  stk::mesh::EntityProcVec& elemsToGhost,
+  std::vector<stk::mesh::EntityId>& receptorIDs,
+  std::vector<stk::mesh::EntityId>& donorIDs);
+
+} // namespace overset_utils
 } // namespace nalu
 } // namespace sierra
 
@@ -0,0 +1,103 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef DEFERREDREDUCTIONS_H
+#define DEFERREDREDUCTIONS_H
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Coalesce small global reductions into a single non-blocking reduction
+ *
+ *  Algorithms whose reduced values are not needed until later (diagnostics,
+ *  output, next time step estimates) enqueue their local contributions along
+ *  with a callback that receives the global values. At a sync point the
+ *  registry packs every pending entry into one buffer and reduces it with a
+ *  single MPI_Iallreduce, where each value carries the operation to be applied
+ *  to it. The callbacks are invoked, in the order of the enqueue calls, once
+ *  the reduction completes.
+ *
+ *  Like the blocking reductions they replace, the enqueue calls are collective:
+ *  all ranks must enqueue the same sequence of (op, numValues) entries between
+ *  two sync points.
+ */
+class DeferredReductions
+{
+public:
+  enum Op { SUM = 0, MIN, MAX };
+
+  using Callback = std::function<void(const double*)>;
+
+  DeferredReductions() = default;
+  ~DeferredReductions();
+
+  DeferredReductions(const DeferredReductions&) = delete;
+  DeferredReductions& operator=(const DeferredReductions&) = delete;
+
+  /** Register local values to be reduced at the next sync point
+   *
+   *  The values are copied, the callback is invoked with the numValues global
+   *  results after the reduction completes.
+   */
+  void
+  enqueue(Op op, const double* values, const int numValues, Callback callback);
+
+  //! Post the fused reduction for all pending entries
+  void start(MPI_Comm comm);
+
+  //! Wait for the reduction posted by start and invoke the callbacks
+  void finish();
+
+  //! Reduce all pending entries and invoke their callbacks
+  void flush(MPI_Comm comm)
+  {
+    start(comm);
+    finish();
+  }
+
+  size_t num_pending() const { return pending_.size(); }
+
+  //! Number of MPI reductions issued so far
+  int num_reductions() const { return numReductions_; }
+
+  //! Number of entries that were coalesced into those reductions
+  int num_coalesced() const { return numCoalesced_; }
+
+private:
+  struct Entry
+  {
+    int offset;
+    int numValues;
+    Callback callback;
+  };
+
+  //! (value, op) pairs of the pending entries
+  std::vector<double> sendBuffer_;
+  std::vector<double> recvBuffer_;
+  std::vector<Entry> pending_;
+  std::vector<Entry> inFlight_;
+
+  MPI_Request request_{MPI_REQUEST_NULL};
+  MPI_Datatype pairType_{MPI_DATATYPE_NULL};
+  MPI_Op fusedOp_{MPI_OP_NULL};
+
+  int numReductions_{0};
+  int numCoalesced_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* DEFERREDREDUCTIONS_H */
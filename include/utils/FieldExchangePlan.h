@@ -0,0 +1,119 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef FIELDEXCHANGEPLAN_H
+#define FIELDEXCHANGEPLAN_H
+
+#include "FieldTypeDef.h"
+#include "KokkosInterface.h"
+#include "ngp_utils/NgpFieldManager.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/NgpMesh.hpp"
+#include "stk_mesh/base/Selector.hpp"
+
+#include <mpi.h>
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Persistent exchange of nodal fields across shared nodes
+ *
+ *  Replaces the STK parallel_sum and copy_owned_to_shared calls for a field
+ *  set that is exchanged every iteration. The shared nodes of the selector
+ *  are grouped by neighbor once, the device pack/unpack lists and buffers
+ *  are sized once, and the messages use persistent MPI requests. All fields
+ *  are packed into a single message per neighbor.
+ *
+ *  The exchange is split into start (pack and post) and finish (wait and
+ *  unpack) so that independent work can be overlapped with communication.
+ *  The plan is tied to the mesh it was built on; Realm rebuilds it after a
+ *  mesh modification.
+ */
+class FieldExchangePlan
+{
+public:
+  enum Operation { SUM = 0, COPY_OWNED_TO_SHARED };
+
+  using EntityView =
+    Kokkos::View<stk::mesh::Entity*, Kokkos::LayoutRight, MemSpace>;
+  using BufferView = Kokkos::View<double*, Kokkos::LayoutRight, MemSpace>;
+
+  FieldExchangePlan(
+    const stk::mesh::BulkData& bulk,
+    Operation op,
+    const std::vector<const stk::mesh::FieldBase*>& fields,
+    const stk::mesh::Selector& selector,
+    const int tag);
+
+  ~FieldExchangePlan();
+
+  FieldExchangePlan(const FieldExchangePlan&) = delete;
+  FieldExchangePlan& operator=(const FieldExchangePlan&) = delete;
+
+  //! Pack the device fields and start the persistent requests
+  void
+  start(const stk::mesh::NgpMesh& ngpMesh, const nalu_ngp::FieldManager&);
+
+  //! Wait for the messages and sum/copy them into the device fields
+  void
+  finish(const stk::mesh::NgpMesh& ngpMesh, const nalu_ngp::FieldManager&);
+
+  void exchange(
+    const stk::mesh::NgpMesh& ngpMesh, const nalu_ngp::FieldManager& fieldMgr)
+  {
+    start(ngpMesh, fieldMgr);
+    finish(ngpMesh, fieldMgr);
+  }
+
+  //! True if the mesh has not been modified since the plan was built
+  bool is_current(const stk::mesh::BulkData& bulk) const
+  {
+    return bulk.synchronized_count() == syncCount_;
+  }
+
+  int num_neighbors() const { return neighbors_.size(); }
+  int tag() const { return tag_; }
+
+private:
+  void post_requests();
+  void free_requests();
+
+  const Operation op_;
+  const int tag_;
+  const MPI_Comm comm_;
+  const size_t syncCount_;
+
+  std::vector<unsigned> fieldOrdinals_;
+  std::vector<int> fieldOffsets_;
+  int stride_{0};
+
+  // nodes packed for / unpacked from neighbors_[p] are in
+  // [offsets[p], offsets[p+1]), sorted by key on all ranks
+  std::vector<int> neighbors_;
+  std::vector<int> sendOffsets_;
+  std::vector<int> recvOffsets_;
+  EntityView sendNodes_;
+  EntityView recvNodes_;
+
+  BufferView sendBuffer_;
+  BufferView recvBuffer_;
+  BufferView::HostMirror hostSendBuffer_;
+  BufferView::HostMirror hostRecvBuffer_;
+
+  std::vector<MPI_Request> requests_;
+  bool inFlight_{false};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* FIELDEXCHANGEPLAN_H */
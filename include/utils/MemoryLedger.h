@@ -0,0 +1,116 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MEMORYLEDGER_H
+#define MEMORYLEDGER_H
+
+#include <mpi.h>
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Attribute bytes allocated by the solver to the data structures that own them
+ *
+ *  The ledger is a per-rank registry of (category, name) -> bytes entries. The
+ *  owners of large allocations (STK fields, linear systems, team scratch,
+ *  actuator and overset data) report their current footprint and the ledger
+ *  keeps track of the high-water mark of every entry as well as of the sum
+ *  over all entries. Realm::provide_memory_summary() refreshes the entries it
+ *  can compute itself and prints the parallel breakdown.
+ */
+class MemoryLedger
+{
+public:
+  enum Category {
+    FIELDS = 0,
+    LINEAR_SYSTEMS,
+    SCRATCH_VIEWS,
+    ACTUATOR,
+    OVERSET,
+    NUM_CATEGORIES
+  };
+
+  struct Entry
+  {
+    size_t bytes{0};
+    size_t peakBytes{0};
+    unsigned numStates{1};
+  };
+
+  using EntryMap = std::map<std::string, Entry>;
+
+  static const char* category_name(Category cat);
+
+  /** Set the current footprint of an entry, updating its high-water mark
+   */
+  void set(
+    Category cat,
+    const std::string& name,
+    const size_t bytes,
+    const unsigned numStates = 1);
+
+  /** Only update the high-water mark of an entry
+   *
+   *  Used for transient allocations (e.g., team scratch) that are not resident
+   *  between calls; the current footprint is left untouched.
+   */
+  void record_peak(Category cat, const std::string& name, const size_t bytes);
+
+  /** Reset the current footprint of all entries in a category to zero
+   *
+   *  The high-water marks are preserved so that entries whose owners have been
+   *  destroyed still show up in the peak breakdown.
+   */
+  void reset(Category cat);
+
+  size_t category_bytes(Category cat) const;
+  size_t category_peak_bytes(Category cat) const;
+  size_t total_bytes() const;
+  size_t peak_total_bytes() const { return peakTotal_; }
+
+  const EntryMap& entries(Category cat) const { return entries_[cat]; }
+
+  /** Register the bytes held by all STK fields on this rank
+   */
+  void register_fields(const stk::mesh::BulkData& bulk);
+
+  /** Print the per-category min/max/sum over all ranks along with the largest
+   *  entries of the rank with the highest high-water mark
+   */
+  void report(std::ostream& out, MPI_Comm comm, const int maxEntries = 10);
+
+private:
+  void update_peak_total();
+
+  std::array<EntryMap, NUM_CATEGORIES> entries_;
+  size_t peakTotal_{0};
+};
+
+/** Bytes held on this rank by all states of a field
+ */
+size_t field_memory_bytes(
+  const stk::mesh::BulkData& bulk, const stk::mesh::FieldBase& field);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MEMORYLEDGER_H */
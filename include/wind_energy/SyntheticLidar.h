@@ -11,7 +11,7 @@
 
 #include <DataProbePostProcessing.h>
 
-#include "xfer/LocalVolumeSearch.h"
+#include "xfer/SamplingStencil.h"
 
 #include "wind_energy/LidarPatterns.h"
 
@@ -37,7 +37,8 @@ public:
     const stk::mesh::BulkData& bulk,
     const stk::mesh::Selector& active,
     const std::string& coordinates_name,
-    double dtratio);
+    double dtratio,
+    bool mesh_moves = false);
 
 private:
   enum class Output { NETCDF, TEXT, DATAPROBE } output_type_{Output::NETCDF};
@@ -48,6 +49,9 @@ private:
 
   std::unique_ptr<SegmentGenerator> segGen;
 
+  std::vector<std::array<double, 3>> beam_points(double time) const;
+  void precompute_trajectory(bool mesh_moves);
+
   void prepare_nc_file();
   void output_nc(
     double time,
@@ -61,7 +65,14 @@ private:
 
   mutable double lidar_time_{0};
   mutable size_t internal_output_counter_{0};
-  std::unique_ptr<LocalVolumeSearchData> search_data_;
+  // cached while the sampled points and the mesh stay put
+  std::unique_ptr<SamplingStencil> stencil_;
+
+  // with precompute_samples_ > 0 the stencil holds the beams of the next
+  // precompute_samples_ lidar times, starting at trajectory_start_time_
+  int precompute_samples_{0};
+  int trajectory_samples_{0};
+  double trajectory_start_time_{0};
 
   double lidar_dt_{2. / 984};
   double scanTime_{2};
@@ -62,6 +62,18 @@ void local_field_interpolation(
   double dtratio,
   LocalVolumeSearchData& data);
 
+// closest local element and isoparametric coordinates of each point;
+// data.ownership marks the points found on this process and data.dist holds
+// the isInElement distance of the chosen element
+void local_point_location(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::Selector& active,
+  const std::vector<std::array<double, 3>>& points,
+  const stk::mesh::Field<double, stk::mesh::Cartesian3d>& coord_field,
+  LocalVolumeSearchData& data,
+  std::vector<stk::mesh::Entity>& elems,
+  std::vector<std::array<double, 3>>& isopar_coords);
+
 } // namespace nalu
 } // namespace sierra
 
@@ -0,0 +1,135 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef SAMPLING_STENCIL_H
+#define SAMPLING_STENCIL_H
+
+#include "KokkosInterface.h"
+#include "xfer/LocalVolumeSearch.h"
+
+#include "stk_mesh/base/Selector.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Cached interpolation stencils for sampling nodal fields at points
+ *
+ *  resolve() locates each point once; the rank holding the closest element
+ *  keeps that element's nodes and their shape function weights. sample() is
+ *  then a device gather and weighted sum over the stored stencils followed by
+ *  one MPI_Alltoallv that delivers every point to its destination rank. No
+ *  mesh entities are created. The stencils are rebuilt when the mesh is
+ *  modified; moving points or a moving mesh require calling resolve() again.
+ */
+class SamplingStencil
+{
+public:
+  SamplingStencil(
+    const stk::mesh::BulkData& bulk,
+    const stk::mesh::Selector& active,
+    const std::string& coordinatesName = "coordinates");
+
+  /** Locate the points; point j is delivered to rank destRank[j]
+   *
+   *  Collective; points and destRank must be identical on all ranks.
+   */
+  void resolve(
+    const std::vector<std::array<double, 3>>& points,
+    const std::vector<int>& destRank);
+
+  /** Sample a nodal field; collective
+   *
+   *  values(j * fieldSize + c) is set for the points delivered to this rank
+   *  and zero elsewhere.
+   */
+  void sample(
+    const stk::mesh::FieldBase& field,
+    const int fieldSize,
+    std::vector<double>& values);
+
+  //! Sample the extrapolation (1 + dtratio) field - dtratio fieldPrev
+  void sample(
+    const stk::mesh::FieldBase& fieldPrev,
+    const stk::mesh::FieldBase& field,
+    const int fieldSize,
+    const double dtratio,
+    std::vector<double>& values);
+
+  /** Sample only the points [pointBegin, pointEnd)
+   *
+   *  values(j * fieldSize + c) then refers to point pointBegin + j. Only the
+   *  stencils of the range are evaluated and exchanged, which lets a caller
+   *  resolve a batch of future sample locations once and consume it in slices.
+   */
+  void sample(
+    const stk::mesh::FieldBase& fieldPrev,
+    const stk::mesh::FieldBase& field,
+    const int fieldSize,
+    const double dtratio,
+    const int pointBegin,
+    const int pointEnd,
+    std::vector<double>& values);
+
+  int num_points() const { return points_.size(); }
+
+  //! 1 for the points delivered to this rank that were found in the mesh
+  const std::vector<int>& found() const { return found_; }
+
+  //! Number of points not found on any rank
+  int num_not_found() const { return numNotFound_; }
+
+  const std::vector<std::array<double, 3>>& points() const { return points_; }
+  const std::vector<int>& destinations() const { return destRank_; }
+
+private:
+  void build_stencils();
+
+  const stk::mesh::BulkData& bulk_;
+  const stk::mesh::Selector active_;
+  const std::string coordinatesName_;
+
+  std::vector<std::array<double, 3>> points_;
+  std::vector<int> destRank_;
+  size_t syncCount_{0};
+  std::unique_ptr<LocalVolumeSearchData> searchData_;
+
+  // stencils of the points located on this rank, ordered by destination and
+  // then by point
+  std::vector<int> ownedPoints_;
+  Kokkos::View<int*, MemSpace> stencilOffsets_;
+  Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace> stencilNodes_;
+  Kokkos::View<double*, MemSpace> stencilWeights_;
+
+  // persistent exchange of the sampled points, counted in points
+  std::vector<int> sendCounts_;
+  std::vector<int> sendDispls_;
+  std::vector<int> recvCounts_;
+  std::vector<int> recvDispls_;
+  std::vector<int> recvPoints_;
+
+  std::vector<int> found_;
+  int numNotFound_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif